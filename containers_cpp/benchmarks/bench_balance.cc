@@ -0,0 +1,55 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "s21_set.h"
+#include "s21_vector.h"
+
+namespace {
+
+// Mixed workload over keys in [0, 2 * size): state.range(1) percent of the
+// operations are lookups, the rest alternate between inserting and erasing a
+// random key, so the set stays around size elements.
+template <class Balance>
+void BM_MixedWorkload(benchmark::State& state) {
+  int size = state.range(0);
+  int read_percent = state.range(1);
+  s21::set<int, std::less<int>, std::allocator<int>, Balance> set;
+  std::mt19937 gen(42);
+  for (int i = 0; i < size; i++) {
+    set.insert(static_cast<int>(gen() % (2 * size)));
+  }
+  const std::size_t kOps = 1 << 14;
+  s21::vector<int> keys(kOps);
+  s21::vector<int> kinds(kOps);
+  for (std::size_t i = 0; i < kOps; i++) {
+    keys[i] = static_cast<int>(gen() % (2 * size));
+    kinds[i] = static_cast<int>(gen() % 100) < read_percent ? 0 : 1 + i % 2;
+  }
+  for (auto _ : state) {
+    std::size_t hits = 0;
+    for (std::size_t i = 0; i < kOps; i++) {
+      if (kinds[i] == 0)
+        hits += set.contains(keys[i]);
+      else if (kinds[i] == 1)
+        set.insert(keys[i]);
+      else
+        set.erase(keys[i]);
+    }
+    benchmark::DoNotOptimize(hits);
+  }
+  state.SetItemsProcessed(state.iterations() * kOps);
+}
+
+void MixedArgs(benchmark::internal::Benchmark* bench) {
+  for (int size : {1 << 10, 1 << 16}) {
+    for (int read_percent : {100, 90, 50, 10}) {
+      bench->Args({size, read_percent});
+    }
+  }
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_MixedWorkload, s21::rb_balance)->Apply(MixedArgs);
+BENCHMARK_TEMPLATE(BM_MixedWorkload, s21::avl_balance)->Apply(MixedArgs);
@@ -0,0 +1,48 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+
+#include "s21_bitmap_set.h"
+#include "s21_set.h"
+
+namespace {
+
+// Two sets of state.range(0) user ids drawn from [0, 4 * size), i.e. about
+// one id in four, intersected once per iteration.
+void BM_BitmapSetIntersect(benchmark::State& state) {
+  std::uint32_t size = state.range(0);
+  std::mt19937 gen(42);
+  s21::bitmap_set a, b;
+  for (std::uint32_t i = 0; i < size; i++) {
+    a.insert(gen() % (4 * size));
+    b.insert(gen() % (4 * size));
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize((a & b).size());
+  }
+  state.counters["bytes_per_value"] =
+      static_cast<double>(a.memory_usage()) / a.size();
+}
+
+void BM_SetIntersect(benchmark::State& state) {
+  std::uint32_t size = state.range(0);
+  std::mt19937 gen(42);
+  s21::set<std::uint32_t> a, b;
+  for (std::uint32_t i = 0; i < size; i++) {
+    a.insert(gen() % (4 * size));
+    b.insert(gen() % (4 * size));
+  }
+  for (auto _ : state) {
+    std::size_t count = 0;
+    a.for_each([&b, &count](const std::uint32_t& v) {
+      count += b.contains(v);
+    });
+    benchmark::DoNotOptimize(count);
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_BitmapSetIntersect)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_SetIntersect)->Arg(1 << 16)->Arg(1 << 20);
@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "s21_set.h"
+#include "s21_vector.h"
+
+namespace {
+
+// The set holds the even keys of [0, 2 * size); state.range(1) percent of
+// the probes are odd keys, i.e. misses.
+void BM_SetContainsMisses(benchmark::State& state) {
+  int size = state.range(0);
+  int miss_percent = state.range(1);
+  bool bloom = state.range(2);
+  s21::set<int> set;
+  std::mt19937 gen(42);
+  for (int i = 0; i < size; i++) {
+    set.insert(2 * static_cast<int>(gen() % size));
+  }
+  if (bloom) {
+    set.enable_bloom_filter(10 * set.size(), 7);
+  }
+  s21::vector<int> keys(1 << 14);
+  for (std::size_t i = 0; i < keys.size(); i++) {
+    int key = 2 * static_cast<int>(gen() % size);
+    keys[i] = static_cast<int>(gen() % 100) < miss_percent ? key + 1 : key;
+  }
+  for (auto _ : state) {
+    std::size_t hits = 0;
+    for (std::size_t i = 0; i < keys.size(); i++) {
+      hits += set.contains(keys[i]);
+    }
+    benchmark::DoNotOptimize(hits);
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+  state.counters["fp_rate"] = set.get_bloom_stats().false_positive_rate();
+}
+
+void MissArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"size", "miss%", "bloom"});
+  for (int size : {1 << 12, 1 << 18}) {
+    for (int miss_percent : {50, 90, 99}) {
+      bench->Args({size, miss_percent, 0});
+      bench->Args({size, miss_percent, 1});
+    }
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_SetContainsMisses)->Apply(MissArgs);
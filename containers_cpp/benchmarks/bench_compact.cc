@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "s21_map.h"
+
+namespace {
+
+// Bulk load, then churn: random keys are erased and reinserted until every
+// node has been reallocated a few times, scattering the nodes over the heap.
+s21::map<int, int> make_map(int size, bool churn, bool compact) {
+  s21::map<int, int> map;
+  for (int i = 0; i < size; i++) {
+    map.insert(i, i);
+  }
+  if (churn) {
+    std::mt19937 gen(42);
+    s21::vector<int*> noise;
+    for (int i = 0; i < 4 * size; i++) {
+      int key = static_cast<int>(gen() % size);
+      map.erase(key);
+      noise.push_back(new int(i));
+      map.insert(key, key);
+    }
+    for (std::size_t i = 0; i < noise.size(); i++) {
+      delete noise[i];
+    }
+  }
+  if (compact) {
+    map.compact();
+  }
+  return map;
+}
+
+void BM_MapScan(benchmark::State& state) {
+  s21::map<int, int> map =
+      make_map(state.range(0), state.range(1), state.range(2));
+  for (auto _ : state) {
+    long sum = 0;
+    for (auto it = map.begin(); it != map.end(); ++it) {
+      sum += *it;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * map.size());
+}
+
+void ScanArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"size", "churn", "compact"});
+  for (int size : {1 << 14, 1 << 18}) {
+    bench->Args({size, 0, 0});
+    bench->Args({size, 1, 0});
+    bench->Args({size, 1, 1});
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_MapScan)->Apply(ScanArgs);
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "s21_set.h"
+#include "s21_vector.h"
+
+namespace {
+
+s21::set<int> make_set(int size) {
+  s21::set<int> set;
+  std::mt19937 gen(42);
+  while (static_cast<int>(set.size()) < size) {
+    set.insert(static_cast<int>(gen() % (size * 4u)));
+  }
+  return set;
+}
+
+s21::vector<int> make_probes(int size) {
+  s21::vector<int> keys(4096);
+  std::mt19937 gen(7);
+  for (std::size_t i = 0; i < keys.size(); i++) {
+    keys[i] = static_cast<int>(gen() % (size * 4u));
+  }
+  return keys;
+}
+
+void BM_SetContains(benchmark::State& state) {
+  s21::set<int> set = make_set(state.range(0));
+  s21::vector<int> keys = make_probes(state.range(0));
+  for (auto _ : state) {
+    std::size_t hits = 0;
+    for (std::size_t i = 0; i < keys.size(); i++) {
+      hits += set.contains(keys[i]);
+    }
+    benchmark::DoNotOptimize(hits);
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+void BM_FrozenSetContains(benchmark::State& state) {
+  s21::set<int> set = make_set(state.range(0));
+  auto frozen = set.freeze();
+  s21::vector<int> keys = make_probes(state.range(0));
+  for (auto _ : state) {
+    std::size_t hits = 0;
+    for (std::size_t i = 0; i < keys.size(); i++) {
+      hits += frozen.contains(keys[i]);
+    }
+    benchmark::DoNotOptimize(hits);
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_SetContains)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_FrozenSetContains)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
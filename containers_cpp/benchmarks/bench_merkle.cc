@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "s21_map.h"
+
+namespace {
+
+using merkle_map = s21::map<int, int, std::less<int>,
+                            std::allocator<std::pair<const int, int>>,
+                            s21::merkle<>>;
+
+// Two replicas of a map built in different insertion orders, the second
+// one with state.range(1) values changed.
+void make_replicas(int size, int changes, bool merkle, merkle_map& a,
+                   merkle_map& b) {
+  for (int i = 0; i < size; i++) {
+    a.insert(i, i);
+    b.insert(size - 1 - i, size - 1 - i);
+  }
+  std::mt19937 gen(42);
+  for (int i = 0; i < changes; i++) {
+    b.insert_or_assign(static_cast<int>(gen() % size), -1);
+  }
+  if (merkle) {
+    a.enable_merkle();
+    b.enable_merkle();
+  }
+}
+
+void BM_MapEqual(benchmark::State& state) {
+  merkle_map a, b;
+  make_replicas(state.range(0), state.range(1), state.range(2), a, b);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a == b);
+  }
+}
+
+void BM_MapDiff(benchmark::State& state) {
+  merkle_map a, b;
+  make_replicas(state.range(0), state.range(1), state.range(2), a, b);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a.diff(b).size());
+  }
+}
+
+void ReplicaArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"size", "changes", "merkle"});
+  for (int changes : {1, 64}) {
+    bench->Args({1 << 18, changes, 0});
+    bench->Args({1 << 18, changes, 1});
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_MapEqual)->Apply(ReplicaArgs);
+BENCHMARK(BM_MapDiff)->Apply(ReplicaArgs);
@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "s21_bucket_multimap.h"
+#include "s21_multimap.h"
+
+namespace {
+
+const int kKeys = 1 << 10;
+
+// kKeys keys with state.range(0) values each, inserted in random key order;
+// each iteration sums the values of one key.
+template <class Multimap>
+void Fill(Multimap& m, int per_key) {
+  std::mt19937 gen(42);
+  for (int i = 0; i < kKeys * per_key; i++) {
+    m.insert(static_cast<int>(gen() % kKeys), i);
+  }
+}
+
+void BM_MultimapScanKey(benchmark::State& state) {
+  s21::multimap<int, int> m;
+  Fill(m, state.range(0));
+  int key = 0;
+  for (auto _ : state) {
+    long sum = 0;
+    m.for_each_value(key, [&sum](const int& value) { sum += value; });
+    benchmark::DoNotOptimize(sum);
+    key = (key + 1) % kKeys;
+  }
+}
+
+void BM_BucketMultimapScanKey(benchmark::State& state) {
+  s21::bucket_multimap<int, int> m;
+  Fill(m, state.range(0));
+  int key = 0;
+  for (auto _ : state) {
+    long sum = 0;
+    const auto* values = m.values(key);
+    for (std::size_t i = 0; values && i < values->size(); i++) {
+      sum += values->data()[i];
+    }
+    benchmark::DoNotOptimize(sum);
+    key = (key + 1) % kKeys;
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_MultimapScanKey)->Arg(4)->Arg(64);
+BENCHMARK(BM_BucketMultimapScanKey)->Arg(4)->Arg(64);
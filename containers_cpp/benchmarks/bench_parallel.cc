@@ -0,0 +1,135 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+
+#include "s21_parallel.h"
+#include "s21_vector.h"
+
+namespace {
+
+// Every benchmark takes the element count as range(0) and the number of
+// threads as range(1); the pool is built outside the timed loop and the
+// time is wall-clock, since CPU time only counts the calling thread.
+s21::parallel::options Options(benchmark::State& state,
+                               s21::parallel::thread_pool& pool) {
+  state.counters["threads"] = static_cast<double>(pool.size());
+  return s21::parallel::options{&pool, s21::parallel::default_grain};
+}
+
+s21::vector<std::int64_t> RandomValues(std::size_t n) {
+  std::mt19937_64 gen(42);
+  s21::vector<std::int64_t> v(n);
+  for (std::size_t i = 0; i < n; i++) v[i] = static_cast<std::int64_t>(gen());
+  return v;
+}
+
+// The input is restored outside the timed region before each run.
+template <bool Stable>
+void BM_Sort(benchmark::State& state) {
+  s21::parallel::thread_pool pool(state.range(1));
+  auto opts = Options(state, pool);
+  const s21::vector<std::int64_t> input = RandomValues(state.range(0));
+  s21::vector<std::int64_t> v;
+  for (auto _ : state) {
+    state.PauseTiming();
+    v = input;
+    state.ResumeTiming();
+    if constexpr (Stable) {
+      s21::parallel::stable_sort(v, std::less<>(), opts);
+    } else {
+      s21::parallel::sort(v, std::less<>(), opts);
+    }
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Single-threaded std::sort on the same input, as the baseline.
+void BM_StdSort(benchmark::State& state) {
+  const s21::vector<std::int64_t> input = RandomValues(state.range(0));
+  s21::vector<std::int64_t> v;
+  for (auto _ : state) {
+    state.PauseTiming();
+    v = input;
+    state.ResumeTiming();
+    std::sort(v.data(), v.data() + v.size());
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ForEach(benchmark::State& state) {
+  s21::parallel::thread_pool pool(state.range(1));
+  auto opts = Options(state, pool);
+  s21::vector<std::int64_t> v = RandomValues(state.range(0));
+  for (auto _ : state) {
+    s21::parallel::for_each(
+        v, [](std::int64_t& x) { x = x * 6364136223846793005 + 1; }, opts);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Transform(benchmark::State& state) {
+  s21::parallel::thread_pool pool(state.range(1));
+  auto opts = Options(state, pool);
+  const s21::vector<std::int64_t> in = RandomValues(state.range(0));
+  s21::vector<double> out(in.size());
+  for (auto _ : state) {
+    s21::parallel::transform(
+        in, out, [](std::int64_t x) { return static_cast<double>(x) * 0.5; },
+        opts);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Reduce(benchmark::State& state) {
+  s21::parallel::thread_pool pool(state.range(1));
+  auto opts = Options(state, pool);
+  const s21::vector<std::int64_t> v = RandomValues(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        s21::parallel::reduce(v, std::int64_t{0}, std::plus<>(), opts));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_InclusiveScan(benchmark::State& state) {
+  s21::parallel::thread_pool pool(state.range(1));
+  auto opts = Options(state, pool);
+  const s21::vector<std::int64_t> in = RandomValues(state.range(0));
+  s21::vector<std::int64_t> out(in.size());
+  for (auto _ : state) {
+    s21::parallel::inclusive_scan(in, out, std::plus<>(), opts);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 1M and 16M elements on 1, 2, 4, ... threads up to the machine's count.
+void ThreadArgs(benchmark::internal::Benchmark* bench) {
+  std::int64_t max_threads = static_cast<std::int64_t>(
+      s21::parallel::thread_pool::default_threads());
+  for (std::int64_t size : {1 << 20, 1 << 24}) {
+    for (std::int64_t threads = 1; threads < max_threads; threads *= 2) {
+      bench->Args({size, threads});
+    }
+    bench->Args({size, max_threads});
+  }
+  bench->UseRealTime()->Unit(benchmark::kMillisecond);
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_Sort, false)->Apply(ThreadArgs);
+BENCHMARK_TEMPLATE(BM_Sort, true)->Apply(ThreadArgs);
+BENCHMARK(BM_StdSort)->Arg(1 << 20)->Arg(1 << 24)->Unit(
+    benchmark::kMillisecond);
+BENCHMARK(BM_ForEach)->Apply(ThreadArgs);
+BENCHMARK(BM_Transform)->Apply(ThreadArgs);
+BENCHMARK(BM_Reduce)->Apply(ThreadArgs);
+BENCHMARK(BM_InclusiveScan)->Apply(ThreadArgs);
@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+
+#include "s21_map.h"
+#include "s21_radix_map.h"
+#include "s21_vector.h"
+
+namespace {
+
+// state.range(0) random 64-bit keys, or strings made of a shared prefix and
+// a number; each iteration is one hit.
+s21::vector<std::uint64_t> IntKeys(int size) {
+  std::mt19937_64 gen(42);
+  s21::vector<std::uint64_t> keys;
+  for (int i = 0; i < size; i++) keys.push_back(gen());
+  return keys;
+}
+
+s21::vector<std::string> StringKeys(int size) {
+  std::mt19937 gen(42);
+  s21::vector<std::string> keys;
+  for (int i = 0; i < size; i++) {
+    keys.push_back("user/session/" + std::to_string(gen()));
+  }
+  return keys;
+}
+
+template <class Map, class Keys>
+void Lookup(benchmark::State& state, const Keys& keys) {
+  Map m;
+  for (std::size_t i = 0; i < keys.size(); i++) m.insert(keys[i], 0);
+  std::mt19937 gen(7);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(m.contains(keys[gen() % keys.size()]));
+  }
+}
+
+void BM_MapIntLookup(benchmark::State& state) {
+  Lookup<s21::map<std::uint64_t, int>>(state, IntKeys(state.range(0)));
+}
+
+void BM_RadixMapIntLookup(benchmark::State& state) {
+  Lookup<s21::radix_map<std::uint64_t, int>>(state, IntKeys(state.range(0)));
+}
+
+void BM_MapStringLookup(benchmark::State& state) {
+  Lookup<s21::map<std::string, int>>(state, StringKeys(state.range(0)));
+}
+
+void BM_RadixMapStringLookup(benchmark::State& state) {
+  Lookup<s21::radix_map<std::string, int>>(state, StringKeys(state.range(0)));
+}
+
+}  // namespace
+
+BENCHMARK(BM_MapIntLookup)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(BM_RadixMapIntLookup)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(BM_MapStringLookup)->Arg(1 << 10)->Arg(1 << 18);
+BENCHMARK(BM_RadixMapStringLookup)->Arg(1 << 10)->Arg(1 << 18);
@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+
+#include "s21_map.h"
+#include "s21_vector.h"
+
+namespace {
+
+s21::map<int, int> make_map(int size) {
+  s21::vector<int> order(size);
+  for (int i = 0; i < size; i++) {
+    order[i] = i;
+  }
+  std::shuffle(order.data(), order.data() + size, std::mt19937(42));
+  s21::map<int, int> map;
+  for (int i = 0; i < size; i++) {
+    map.insert(order[i], i);
+  }
+  return map;
+}
+
+void BM_MapScanIterator(benchmark::State& state) {
+  s21::map<int, int> map = make_map(state.range(0));
+  for (auto _ : state) {
+    long sum = 0;
+    for (auto it = map.begin(); it != map.end(); ++it) {
+      sum += *it;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * map.size());
+}
+
+void BM_MapScanForEach(benchmark::State& state) {
+  s21::map<int, int> map = make_map(state.range(0));
+  for (auto _ : state) {
+    long sum = 0;
+    map.for_each([&sum](const int&, const int& value) { sum += value; });
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * map.size());
+}
+
+// Scans the middle half of the key space.
+void BM_MapRangeIterator(benchmark::State& state) {
+  int size = state.range(0);
+  s21::map<int, int> map = make_map(size);
+  for (auto _ : state) {
+    long sum = 0;
+    auto last = map.lower_bound(size / 4 * 3);
+    for (auto it = map.lower_bound(size / 4); it != last; ++it) {
+      sum += *it;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * (size / 2));
+}
+
+void BM_MapRangeForEach(benchmark::State& state) {
+  int size = state.range(0);
+  s21::map<int, int> map = make_map(size);
+  for (auto _ : state) {
+    long sum = 0;
+    map.for_each_in_range(size / 4, size / 4 * 3,
+                          [&sum](const int&, const int& value) {
+                            sum += value;
+                          });
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * (size / 2));
+}
+
+void BM_MapCopyKeys(benchmark::State& state) {
+  s21::map<int, int> map = make_map(state.range(0));
+  for (auto _ : state) {
+    s21::vector<int> keys;
+    map.copy_keys_to(keys);
+    benchmark::DoNotOptimize(keys.data());
+  }
+  state.SetItemsProcessed(state.iterations() * map.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_MapScanIterator)->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_MapScanForEach)->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_MapRangeIterator)->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_MapRangeForEach)->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_MapCopyKeys)->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
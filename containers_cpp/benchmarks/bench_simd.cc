@@ -0,0 +1,143 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include "s21_array.h"
+#include "s21_simd.h"
+#include "s21_vector.h"
+
+namespace {
+
+using s21::simd::level;
+
+const char* level_name(level l) {
+  switch (l) {
+    case level::avx2:
+      return "avx2";
+    case level::sse2:
+      return "sse2";
+    default:
+      return "scalar";
+  }
+}
+
+// Every benchmark takes the element count as range(0) and the kernel level
+// as range(1); levels the CPU lacks run at the best one it has, and the
+// label shows which level actually ran.
+class LevelScope {
+ public:
+  explicit LevelScope(benchmark::State& state)
+      : saved_(s21::simd::set_level(static_cast<level>(state.range(1)))) {
+    state.SetLabel(level_name(s21::simd::active_level()));
+  }
+  ~LevelScope() { s21::simd::set_level(saved_); }
+
+ private:
+  level saved_;
+};
+
+void SetBytes(benchmark::State& state, std::size_t bytes_per_element) {
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          bytes_per_element);
+}
+
+// The needle sits in the last element, so the whole vector is scanned.
+template <class T>
+void BM_Find(benchmark::State& state) {
+  LevelScope scope(state);
+  s21::vector<T> v(state.range(0), T(1));
+  v.back() = T(2);
+  for (auto _ : state) {
+    auto it = s21::find(v, T(2));
+    benchmark::DoNotOptimize(it);
+  }
+  SetBytes(state, sizeof(T));
+}
+
+template <class T>
+void BM_Count(benchmark::State& state) {
+  LevelScope scope(state);
+  s21::vector<T> v(state.range(0));
+  for (std::size_t i = 0; i < v.size(); i++) v[i] = T(i % 3);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s21::count(v, T(2)));
+  }
+  SetBytes(state, sizeof(T));
+}
+
+// Equal vectors, the worst case for operator==.
+template <class T>
+void BM_Equal(benchmark::State& state) {
+  LevelScope scope(state);
+  s21::vector<T> a(state.range(0), T(1));
+  s21::vector<T> b(state.range(0), T(1));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a == b);
+  }
+  SetBytes(state, 2 * sizeof(T));
+}
+
+// Vectors differing only in the last element.
+template <class T>
+void BM_Less(benchmark::State& state) {
+  LevelScope scope(state);
+  s21::vector<T> a(state.range(0), T(1));
+  s21::vector<T> b(state.range(0), T(1));
+  b.back() = T(2);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a < b);
+  }
+  SetBytes(state, 2 * sizeof(T));
+}
+
+template <class T>
+void BM_Fill(benchmark::State& state) {
+  LevelScope scope(state);
+  s21::vector<T> v(state.range(0));
+  for (auto _ : state) {
+    s21::simd::fill(v.data(), v.size(), T(7));
+    benchmark::ClobberMemory();
+  }
+  SetBytes(state, sizeof(T));
+}
+
+// A small fixed-size array, where the call and dispatch overhead matter
+// more than the loop.
+void BM_ArrayEqual(benchmark::State& state) {
+  LevelScope scope(state);
+  s21::array<std::int32_t, 16> a;
+  s21::array<std::int32_t, 16> b;
+  a.fill(1);
+  b.fill(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a == b);
+  }
+}
+
+// Sizes from 16 to 16M elements at each level.
+void SizeArgs(benchmark::internal::Benchmark* bench) {
+  for (level l : {level::scalar, level::sse2, level::avx2}) {
+    for (std::int64_t size = 16; size <= (16 << 20); size *= 16) {
+      bench->Args({size, static_cast<std::int64_t>(l)});
+    }
+  }
+}
+
+void LevelArgs(benchmark::internal::Benchmark* bench) {
+  for (level l : {level::scalar, level::sse2, level::avx2}) {
+    bench->Args({16, static_cast<std::int64_t>(l)});
+  }
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_Find, std::int8_t)->Apply(SizeArgs);
+BENCHMARK_TEMPLATE(BM_Find, std::int32_t)->Apply(SizeArgs);
+BENCHMARK_TEMPLATE(BM_Find, double)->Apply(SizeArgs);
+BENCHMARK_TEMPLATE(BM_Count, std::int8_t)->Apply(SizeArgs);
+BENCHMARK_TEMPLATE(BM_Count, std::int32_t)->Apply(SizeArgs);
+BENCHMARK_TEMPLATE(BM_Equal, std::int32_t)->Apply(SizeArgs);
+BENCHMARK_TEMPLATE(BM_Equal, double)->Apply(SizeArgs);
+BENCHMARK_TEMPLATE(BM_Less, std::int32_t)->Apply(SizeArgs);
+BENCHMARK_TEMPLATE(BM_Fill, std::int32_t)->Apply(SizeArgs);
+BENCHMARK(BM_ArrayEqual)->Apply(LevelArgs);
@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "s21_small_vector.h"
+#include "s21_vector.h"
+
+namespace {
+
+// Builds and drops a vector of state.range(0) ints per iteration, the
+// shape of a per-request scratch list. allocs_per_vector counts how often
+// data() moved, i.e. heap allocations, since both types only reallocate
+// when they grow.
+template <class Vector>
+void BM_ShortLived(benchmark::State& state) {
+  std::size_t allocs = 0;
+  for (auto _ : state) {
+    Vector v;
+    const int* data = v.data();
+    for (int i = 0; i < state.range(0); i++) {
+      v.push_back(i);
+      if (v.data() != data) {
+        data = v.data();
+        allocs++;
+      }
+    }
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.counters["allocs_per_vector"] =
+      static_cast<double>(allocs) / state.iterations();
+}
+
+// Same with std::string elements, which are relocated by move on a spill.
+template <class Vector>
+void BM_ShortLivedStrings(benchmark::State& state) {
+  for (auto _ : state) {
+    Vector v;
+    for (int i = 0; i < state.range(0); i++) v.emplace_back(4, 'x');
+    benchmark::DoNotOptimize(v.data());
+  }
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_ShortLived, s21::vector<int>)->Arg(4)->Arg(8)->Arg(32);
+BENCHMARK_TEMPLATE(BM_ShortLived, s21::small_vector<int, 8>)
+    ->Arg(4)
+    ->Arg(8)
+    ->Arg(32);
+BENCHMARK_TEMPLATE(BM_ShortLived, std::vector<int>)->Arg(4)->Arg(8)->Arg(32);
+BENCHMARK_TEMPLATE(BM_ShortLivedStrings, s21::vector<std::string>)->Arg(6);
+BENCHMARK_TEMPLATE(BM_ShortLivedStrings, s21::small_vector<std::string, 8>)
+    ->Arg(6);
@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "s21_set.h"
+#include "s21_splay_set.h"
+#include "s21_vector.h"
+
+namespace {
+
+// Keys drawn from a Zipf(1.1) distribution over [0, size), with the rank
+// scattered over the key space so hot keys are not neighbours in the tree.
+s21::vector<int> make_zipf_probes(int size, std::size_t count) {
+  s21::vector<double> cdf(size);
+  double sum = 0;
+  for (int i = 0; i < size; i++) {
+    sum += 1.0 / std::pow(i + 1, 1.1);
+    cdf[i] = sum;
+  }
+  std::mt19937 gen(7);
+  std::uniform_real_distribution<double> dist(0, sum);
+  s21::vector<int> keys(count);
+  for (std::size_t i = 0; i < count; i++) {
+    double x = dist(gen);
+    int lo = 0, hi = size - 1;
+    while (lo < hi) {
+      int mid = (lo + hi) / 2;
+      if (cdf[mid] < x)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    keys[i] = static_cast<int>((lo * 2654435761u) % size);
+  }
+  return keys;
+}
+
+template <class Set>
+void BM_ZipfContains(benchmark::State& state) {
+  int size = state.range(0);
+  Set set;
+  s21::vector<int> order(size);
+  for (int i = 0; i < size; i++) {
+    order[i] = i;
+  }
+  std::shuffle(order.data(), order.data() + size, std::mt19937(42));
+  for (int i = 0; i < size; i++) {
+    set.insert(order[i]);
+  }
+  s21::vector<int> keys = make_zipf_probes(size, 1 << 14);
+  for (auto _ : state) {
+    std::size_t hits = 0;
+    for (std::size_t i = 0; i < keys.size(); i++) {
+      hits += set.contains(keys[i]);
+    }
+    benchmark::DoNotOptimize(hits);
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_ZipfContains, s21::set<int>)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_ZipfContains, s21::splay_set<int>)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 18);
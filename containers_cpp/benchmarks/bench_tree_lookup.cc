@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "s21_map.h"
+#include "s21_vector.h"
+
+namespace {
+
+s21::map<int, int> make_map(int size) {
+  s21::map<int, int> map;
+  std::mt19937 gen(42);
+  for (int i = 0; i < size; i++) {
+    map.insert(static_cast<int>(gen()), i);
+  }
+  return map;
+}
+
+s21::vector<int> make_keys(std::size_t count) {
+  s21::vector<int> keys(count);
+  std::mt19937 gen(7);
+  for (std::size_t i = 0; i < count; i++) {
+    keys[i] = static_cast<int>(gen());
+  }
+  return keys;
+}
+
+void BM_MapContainsLoop(benchmark::State& state) {
+  s21::map<int, int> map = make_map(state.range(0));
+  s21::vector<int> keys = make_keys(state.range(1));
+  s21::vector<int> found(keys.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < keys.size(); i++) {
+      found[i] = map.contains(keys[i]);
+    }
+    benchmark::DoNotOptimize(found.data());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+void BM_MapContainsMany(benchmark::State& state) {
+  s21::map<int, int> map = make_map(state.range(0));
+  s21::vector<int> keys = make_keys(state.range(1));
+  s21::vector<int> found(keys.size());
+  for (auto _ : state) {
+    map.contains_many(keys.data(), keys.data() + keys.size(), found.data());
+    benchmark::DoNotOptimize(found.data());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+void lookup_args(benchmark::internal::Benchmark* bench) {
+  for (int size : {1 << 10, 1 << 16, 1 << 20}) {
+    for (int batch : {64, 1024}) {
+      bench->Args({size, batch});
+    }
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_MapContainsLoop)->Apply(lookup_args);
+BENCHMARK(BM_MapContainsMany)->Apply(lookup_args);
@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "s21_map.h"
+#include "s21_ttl_map.h"
+#include "s21_vector.h"
+
+namespace {
+
+using ttl_map = s21::ttl_map<int, int>;
+using seconds = std::chrono::seconds;
+
+// state.range(0) live sessions with lifetimes of up to 1000 ticks; every
+// tick opens 16 sessions and drops the expired ones.
+const int kPerTick = 16;
+
+void BM_TtlMapTick(benchmark::State& state) {
+  int size = state.range(0);
+  int max_ttl = 1000;
+  ttl_map sessions;
+  std::mt19937 gen(42);
+  int now = 0, next_key = 0;
+  for (int i = 0; i < size; i++, next_key++) {
+    sessions.insert(next_key, next_key, seconds(gen() % max_ttl + 1),
+                    ttl_map::time_point(seconds(now)));
+  }
+  for (auto _ : state) {
+    ttl_map::time_point t{seconds(++now)};
+    for (int i = 0; i < kPerTick; i++, next_key++) {
+      sessions.insert(next_key, next_key, seconds(gen() % max_ttl + 1), t);
+    }
+    benchmark::DoNotOptimize(sessions.expire(t));
+  }
+  state.counters["size"] = sessions.size();
+}
+
+// The same sessions in an s21::map of deadlines swept every tick.
+void BM_MapSweepTick(benchmark::State& state) {
+  int size = state.range(0);
+  int max_ttl = 1000;
+  s21::map<int, int> sessions;
+  std::mt19937 gen(42);
+  int now = 0, next_key = 0;
+  for (int i = 0; i < size; i++, next_key++) {
+    sessions.insert(next_key, now + static_cast<int>(gen() % max_ttl) + 1);
+  }
+  s21::vector<int> expired;
+  for (auto _ : state) {
+    ++now;
+    for (int i = 0; i < kPerTick; i++, next_key++) {
+      sessions.insert(next_key, now + static_cast<int>(gen() % max_ttl) + 1);
+    }
+    expired.clear();
+    sessions.for_each([&expired, now](const int& key, const int& deadline) {
+      if (deadline <= now) expired.push_back(key);
+    });
+    for (std::size_t i = 0; i < expired.size(); i++) {
+      sessions.erase(expired[i]);
+    }
+    benchmark::DoNotOptimize(expired.size());
+  }
+  state.counters["size"] = sessions.size();
+}
+
+}  // namespace
+
+BENCHMARK(BM_TtlMapTick)->Arg(1 << 10)->Arg(1 << 14);
+BENCHMARK(BM_MapSweepTick)->Arg(1 << 10)->Arg(1 << 14);
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "s21_vector.h"
+
+namespace {
+
+// Appends state.range(0) elements to an empty vector, so the run is
+// dominated by the log2(n) reallocations and what they do with the
+// elements already stored. The strings are too long for the small string
+// buffer, so copying one on growth means a heap allocation.
+template <class Vector>
+void BM_GrowStrings(benchmark::State& state) {
+  const std::string value(48, 'x');
+  for (auto _ : state) {
+    Vector v;
+    for (int i = 0; i < state.range(0); i++) v.push_back(value);
+    benchmark::DoNotOptimize(v.data());
+  }
+}
+
+template <class Vector>
+void BM_GrowInts(benchmark::State& state) {
+  for (auto _ : state) {
+    Vector v;
+    for (int i = 0; i < state.range(0); i++) v.push_back(i);
+    benchmark::DoNotOptimize(v.data());
+  }
+}
+
+// Inserts a block of 64 values into the middle of a vector of
+// state.range(0) ints; the vector is rebuilt outside the timed region.
+template <class Vector>
+void BM_InsertRangeMiddle(benchmark::State& state) {
+  const std::vector<int> block(64, 7);
+  for (auto _ : state) {
+    state.PauseTiming();
+    Vector v(state.range(0));
+    state.ResumeTiming();
+    v.insert(v.begin() + v.size() / 2, block.begin(), block.end());
+    benchmark::DoNotOptimize(v.data());
+  }
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_GrowStrings, s21::vector<std::string>)
+    ->Arg(1 << 10)
+    ->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_GrowStrings, std::vector<std::string>)
+    ->Arg(1 << 10)
+    ->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_GrowInts, s21::vector<int>)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_GrowInts, std::vector<int>)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_InsertRangeMiddle, s21::vector<int>)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_InsertRangeMiddle, std::vector<int>)->Arg(1 << 16);
@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+#include <random>
+
+#include "s21_map.h"
+#include "s21_versioned_map.h"
+
+namespace {
+
+const int kSize = 1 << 16;
+
+// Thread 0 writes (insert_or_assign and erase of random keys), the other
+// threads read: each iteration is one lookup, every 64th one a scan of 256
+// elements from a fresh snapshot.
+s21::versioned_map<int, int>* versioned;
+
+void BM_VersionedMapMixed(benchmark::State& state) {
+  if (state.thread_index() == 0) {
+    versioned = new s21::versioned_map<int, int>();
+    for (int i = 0; i < kSize; i += 2) versioned->insert(i, i);
+  }
+  std::mt19937 gen(state.thread_index());
+  for (auto _ : state) {
+    int key = static_cast<int>(gen() % kSize);
+    if (state.thread_index() == 0) {
+      if (key % 2)
+        versioned->erase(key - 1);
+      else
+        versioned->insert_or_assign(key, key);
+    } else if (key % 64) {
+      benchmark::DoNotOptimize(versioned->contains(key));
+    } else {
+      auto snap = versioned->get_snapshot();
+      long sum = 0;
+      int n = 0;
+      for (auto it = snap.begin(); it != snap.end() && n < 256; ++it, ++n) {
+        sum += *it;
+      }
+      benchmark::DoNotOptimize(sum);
+    }
+  }
+  if (state.thread_index() == 0) {
+    delete versioned;
+  }
+}
+
+// Same workload over an s21::map guarded by one mutex.
+s21::map<int, int>* locked;
+std::mutex locked_mutex;
+
+void BM_LockedMapMixed(benchmark::State& state) {
+  if (state.thread_index() == 0) {
+    locked = new s21::map<int, int>();
+    for (int i = 0; i < kSize; i += 2) locked->insert(i, i);
+  }
+  std::mt19937 gen(state.thread_index());
+  for (auto _ : state) {
+    int key = static_cast<int>(gen() % kSize);
+    std::lock_guard<std::mutex> lock(locked_mutex);
+    if (state.thread_index() == 0) {
+      if (key % 2)
+        locked->erase(key - 1);
+      else
+        locked->insert_or_assign(key, key);
+    } else if (key % 64) {
+      benchmark::DoNotOptimize(locked->contains(key));
+    } else {
+      long sum = 0;
+      int n = 0;
+      for (auto it = locked->begin(); it != locked->end() && n < 256;
+           ++it, ++n) {
+        sum += *it;
+      }
+      benchmark::DoNotOptimize(sum);
+    }
+  }
+  if (state.thread_index() == 0) {
+    delete locked;
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_VersionedMapMixed)->Threads(2)->Threads(4)->UseRealTime();
+BENCHMARK(BM_LockedMapMixed)->Threads(2)->Threads(4)->UseRealTime();
@@ -0,0 +1,182 @@
+#ifndef S21_CONTAINERS_SRC_S21_ALLOCATOR_H
+#define S21_CONTAINERS_SRC_S21_ALLOCATOR_H
+
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace s21 {
+
+// Base of the allocator-aware containers. The allocator is kept as a base
+// class so that stateless ones such as std::allocator take no space.
+template <class Alloc>
+class allocator_holder : private Alloc {
+ protected:
+  using alloc_traits = std::allocator_traits<Alloc>;
+
+  allocator_holder() noexcept(noexcept(Alloc())) : Alloc() {}
+
+  explicit allocator_holder(const Alloc &alloc) noexcept : Alloc(alloc) {}
+
+  Alloc &alloc() noexcept { return *this; }
+
+  const Alloc &alloc() const noexcept { return *this; }
+
+  bool same_alloc(const Alloc &other) const noexcept {
+    if constexpr (alloc_traits::is_always_equal::value) {
+      return true;
+    } else {
+      return alloc() == other;
+    }
+  }
+
+  // The propagate_on_container_* traits: the allocator follows the
+  // elements on copy assignment, move assignment or swap only when the
+  // allocator asks for it.
+  void copy_alloc(const Alloc &other) noexcept {
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                      value) {
+      alloc() = other;
+    }
+  }
+
+  void move_alloc(Alloc &other) noexcept {
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                      value) {
+      alloc() = std::move(other);
+    }
+  }
+
+  void swap_alloc(Alloc &other) noexcept {
+    if constexpr (alloc_traits::propagate_on_container_swap::value) {
+      using std::swap;
+      swap(alloc(), other);
+    }
+  }
+};
+
+// Blocks of one size kept for reuse: a released block waits on a free list,
+// up to max_free of them, instead of going back to operator delete. Every
+// block comes from operator new, so any pool may release any block of its
+// size.
+class node_pool {
+ public:
+  using size_type = std::size_t;
+
+  node_pool(size_type block_size, size_type max_free) noexcept
+      : block_size_(block_size < sizeof(free_block) ? sizeof(free_block)
+                                                    : block_size),
+        max_free_(max_free),
+        free_(nullptr),
+        free_count_(0) {}
+
+  node_pool(const node_pool &) = delete;
+
+  node_pool &operator=(const node_pool &) = delete;
+
+  ~node_pool() { trim(0); }
+
+  size_type block_size() const noexcept { return block_size_; }
+
+  size_type free_count() const noexcept { return free_count_; }
+
+  void *allocate() {
+    if (free_ == nullptr) return ::operator new(block_size_);
+    free_block *block = free_;
+    free_ = block->next;
+    free_count_--;
+    return block;
+  }
+
+  void deallocate(void *block) noexcept {
+    if (free_count_ >= max_free_) {
+      ::operator delete(block);
+      return;
+    }
+    free_ = new (block) free_block{free_};
+    free_count_++;
+  }
+
+  // Frees waiting blocks beyond the new limit.
+  void set_max_free(size_type max_free) noexcept {
+    max_free_ = max_free;
+    trim(max_free);
+  }
+
+  void swap(node_pool &other) noexcept {
+    std::swap(block_size_, other.block_size_);
+    std::swap(max_free_, other.max_free_);
+    std::swap(free_, other.free_);
+    std::swap(free_count_, other.free_count_);
+  }
+
+ private:
+  struct free_block {
+    free_block *next;
+  };
+
+  void trim(size_type count) noexcept {
+    while (free_count_ > count) {
+      free_block *block = free_;
+      free_ = block->next;
+      free_count_--;
+      ::operator delete(block);
+    }
+  }
+
+  size_type block_size_;
+  size_type max_free_;
+  free_block *free_;
+  size_type free_count_;
+};
+
+// Allocator serving single objects of the pool's block size from a
+// node_pool, for the node containers; other requests go to operator new.
+// All instances compare equal, since every block comes from operator new.
+template <class T>
+class pool_allocator {
+ public:
+  using value_type = T;
+
+  explicit pool_allocator(node_pool *pool) noexcept : pool_(pool) {}
+
+  template <class U>
+  pool_allocator(const pool_allocator<U> &other) noexcept
+      : pool_(other.pool()) {}
+
+  T *allocate(std::size_t n) {
+    if (pooled(n)) return static_cast<T *>(pool_->allocate());
+    return static_cast<T *>(::operator new(n * sizeof(T)));
+  }
+
+  void deallocate(T *p, std::size_t n) noexcept {
+    if (pooled(n))
+      pool_->deallocate(p);
+    else
+      ::operator delete(p);
+  }
+
+  node_pool *pool() const noexcept { return pool_; }
+
+  template <class U>
+  bool operator==(const pool_allocator<U> &) const noexcept {
+    return true;
+  }
+
+  template <class U>
+  bool operator!=(const pool_allocator<U> &) const noexcept {
+    return false;
+  }
+
+ private:
+  bool pooled(std::size_t n) const noexcept {
+    return n == 1 && sizeof(T) == pool_->block_size() &&
+           alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+  }
+
+  node_pool *pool_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_ALLOCATOR_H
@@ -5,6 +5,8 @@
 #include <iostream>
 #include <string>
 
+#include "s21_simd.h"
+
 namespace s21 {
 
 using diff_type = std::ptrdiff_t;
@@ -326,7 +328,7 @@ class array {
 
   constexpr size_type max_size() const noexcept { return N; }
 
-  void fill(const_reference value) { std::fill(arr, arr + N, value); }
+  void fill(const_reference value) { simd::fill(arr, N, value); }
 
   void swap(array& other) noexcept { std::swap(arr, other.arr); }
 
@@ -374,17 +376,11 @@ class array {
   T arr[N];
 };
 
+// Arithmetic elements are compared with the SIMD kernels of s21_simd.h.
+
 template <class T, size_type N>
 bool operator==(array<T, N> const& lhs, array<T, N> const& rhs) {
-  if (lhs.size() != rhs.size()) {
-    return false;
-  }
-  for (size_type i = 0; i < lhs.size(); i++) {
-    if (lhs[i] != rhs[i]) {
-      return false;
-    }
-  }
-  return true;
+  return simd::equal(lhs.data(), rhs.data(), N);
 }
 
 template <class T, size_type N>
@@ -394,33 +390,17 @@ bool operator!=(array<T, N> const& lhs, array<T, N> const& rhs) {
 
 template <class T, size_type N>
 bool operator<(array<T, N> const& lhs, array<T, N> const& rhs) {
-  size_type min_size = std::min(lhs.size(), rhs.size());
-  for (size_type idx = 0; idx < min_size; ++idx) {
-    if (lhs[idx] < rhs[idx]) {
-      return true;
-    } else if (lhs[idx] > rhs[idx]) {
-      return false;
-    }
-  }
-  return lhs.size() < rhs.size();
+  return simd::lexicographical_compare(lhs.data(), N, rhs.data(), N);
 }
 
 template <class T, size_type N>
 bool operator<=(array<T, N> const& lhs, array<T, N> const& rhs) {
-  return !(lhs > rhs);
+  return !(rhs < lhs);
 }
 
 template <class T, size_type N>
 bool operator>(array<T, N> const& lhs, array<T, N> const& rhs) {
-  size_type min_size = std::min(lhs.size(), rhs.size());
-  for (size_type idx = 0; idx < min_size; ++idx) {
-    if (lhs[idx] > rhs[idx]) {
-      return true;
-    } else if (lhs[idx] < rhs[idx]) {
-      return false;
-    }
-  }
-  return lhs.size() > rhs.size();
+  return rhs < lhs;
 }
 
 template <class T, size_type N>
@@ -428,6 +408,25 @@ bool operator>=(array<T, N> const& lhs, array<T, N> const& rhs) {
   return !(lhs < rhs);
 }
 
+// First element equal to value, or end().
+template <class T, size_type N>
+typename array<T, N>::iterator find(array<T, N>& arr, const T& value) {
+  return typename array<T, N>::iterator(
+      arr.data() + simd::find(arr.data(), N, value));
+}
+
+template <class T, size_type N>
+typename array<T, N>::const_iterator find(array<T, N> const& arr,
+                                          const T& value) {
+  return typename array<T, N>::const_iterator(
+      arr.data() + simd::find(arr.data(), N, value));
+}
+
+template <class T, size_type N>
+size_type count(array<T, N> const& arr, const T& value) {
+  return simd::count(arr.data(), N, value);
+}
+
 template <class T, size_type N>
 std::ostream& operator<<(std::ostream& os, array<T, N> const& arr) {
   os << "{";
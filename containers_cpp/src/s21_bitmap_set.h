@@ -0,0 +1,565 @@
+#ifndef S21_CONTAINERS_SRC_S21_BITMAP_SET_H
+#define S21_CONTAINERS_SRC_S21_BITMAP_SET_H
+
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+
+#include "s21_vector.h"
+
+namespace s21 {
+// The values of a bitmap_set sharing their upper 16 bits, stored in
+// whichever of three layouts is smallest for them:
+//   kArray  - sorted low halves, for up to kArrayMax values;
+//   kBitmap - 65536 bits;
+//   kRun    - sorted (start, length - 1) pairs, made by run_optimize().
+struct BitmapChunk {
+  using size_type = std::size_t;
+
+  enum : std::uint8_t { kArray, kBitmap, kRun };
+
+  static constexpr size_type kArrayMax = 4096;
+  static constexpr size_type kWords = 1024;
+
+  BitmapChunk() : key(0), type(kArray), cardinality(0) {}
+
+  explicit BitmapChunk(std::uint16_t k)
+      : key(k), type(kArray), cardinality(0) {}
+
+  bool contains(std::uint16_t low) const {
+    switch (type) {
+      case kArray: {
+        size_type pos = find(low);
+        return pos < values.size() && values[pos] == low;
+      }
+      case kBitmap:
+        return words[low >> 6] >> (low & 63) & 1;
+      default: {
+        size_type runs = values.size() / 2, lo = 0, hi = runs;
+        while (lo < hi) {
+          size_type mid = (lo + hi) / 2;
+          if (values[2 * mid] <= low)
+            lo = mid + 1;
+          else
+            hi = mid;
+        }
+        return lo && low - values[2 * lo - 2] <= values[2 * lo - 1];
+      }
+    }
+  }
+
+  bool add(std::uint16_t low) {
+    if (type == kRun) materialize();
+    if (type == kBitmap) {
+      std::uint64_t bit = std::uint64_t(1) << (low & 63);
+      if (words[low >> 6] & bit) return false;
+      words[low >> 6] |= bit;
+      cardinality++;
+      return true;
+    }
+    size_type pos = find(low);
+    if (pos < values.size() && values[pos] == low) return false;
+    if (cardinality == kArrayMax) {
+      to_bitmap();
+      return add(low);
+    }
+    // Shifts in place; vector::insert would copy the whole array.
+    values.push_back(low);
+    for (size_type i = values.size() - 1; i > pos; i--) {
+      values[i] = values[i - 1];
+    }
+    values[pos] = low;
+    cardinality++;
+    return true;
+  }
+
+  bool remove(std::uint16_t low) {
+    if (!contains(low)) return false;
+    if (type == kRun) materialize();
+    cardinality--;
+    if (type == kArray) {
+      values.erase(values.cbegin() + find(low));
+    } else {
+      words[low >> 6] &= ~(std::uint64_t(1) << (low & 63));
+      if (cardinality <= kArrayMax) to_array();
+    }
+    return true;
+  }
+
+  // Smallest value >= low, or -1. pos is the array index or run of the
+  // previous result and makes sequential calls O(1) for arrays and runs.
+  int next(int low, size_type &pos) const {
+    if (low > 0xffff) return -1;
+    switch (type) {
+      case kArray:
+        while (pos < values.size() && values[pos] < low) pos++;
+        return pos < values.size() ? values[pos] : -1;
+      case kBitmap: {
+        size_type w = low >> 6;
+        std::uint64_t word = words[w] & (~std::uint64_t(0) << (low & 63));
+        while (!word) {
+          if (++w == kWords) return -1;
+          word = words[w];
+        }
+        return static_cast<int>(w * 64 + __builtin_ctzll(word));
+      }
+      default:
+        while (pos < values.size() / 2 &&
+               values[2 * pos] + values[2 * pos + 1] < low)
+          pos++;
+        if (pos == values.size() / 2) return -1;
+        return low > values[2 * pos] ? low : values[2 * pos];
+    }
+  }
+
+  // Calls fn(low) for every value in order.
+  template <class Fn>
+  void for_each(Fn fn) const {
+    switch (type) {
+      case kArray:
+        for (size_type i = 0; i < values.size(); i++) fn(values[i]);
+        break;
+      case kBitmap:
+        for (size_type w = 0; w < kWords; w++) {
+          for (std::uint64_t word = words[w]; word; word &= word - 1) {
+            fn(static_cast<std::uint16_t>(w * 64 + __builtin_ctzll(word)));
+          }
+        }
+        break;
+      default:
+        for (size_type i = 0; i < values.size(); i += 2) {
+          int last = values[i] + values[i + 1];
+          for (int v = values[i]; v <= last; v++) {
+            fn(static_cast<std::uint16_t>(v));
+          }
+        }
+    }
+  }
+
+  // Turns a run chunk back into an array or a bitmap.
+  void materialize() {
+    if (type != kRun) return;
+    vector<std::uint16_t> runs;
+    runs.swap(values);
+    if (cardinality <= kArrayMax) {
+      type = kArray;
+      values.reserve(cardinality);
+      for (size_type i = 0; i < runs.size(); i += 2) {
+        for (int v = runs[i]; v <= runs[i] + runs[i + 1]; v++) {
+          values.push_back(static_cast<std::uint16_t>(v));
+        }
+      }
+    } else {
+      type = kBitmap;
+      words = vector<std::uint64_t>(kWords, 0);
+      for (size_type i = 0; i < runs.size(); i += 2) {
+        for (int v = runs[i]; v <= runs[i] + runs[i + 1]; v++) {
+          words[v >> 6] |= std::uint64_t(1) << (v & 63);
+        }
+      }
+    }
+  }
+
+  void to_bitmap() {
+    words = vector<std::uint64_t>(kWords, 0);
+    for (size_type i = 0; i < values.size(); i++) {
+      words[values[i] >> 6] |= std::uint64_t(1) << (values[i] & 63);
+    }
+    values = vector<std::uint16_t>();
+    type = kBitmap;
+  }
+
+  void to_array() {
+    vector<std::uint16_t> array;
+    array.reserve(cardinality);
+    for_each([&array](std::uint16_t low) { array.push_back(low); });
+    values.swap(array);
+    words = vector<std::uint64_t>();
+    type = kArray;
+  }
+
+  // Switches to runs if they take less memory than the current layout.
+  void run_optimize() {
+    materialize();
+    size_type runs = 0;
+    int prev = -2;
+    for_each([&runs, &prev](std::uint16_t low) {
+      if (low != prev + 1) runs++;
+      prev = low;
+    });
+    size_type size = type == kArray ? 2 * cardinality : 8 * kWords;
+    if (4 * runs >= size) return;
+    vector<std::uint16_t> pairs;
+    pairs.reserve(2 * runs);
+    prev = -2;
+    for_each([&pairs, &prev](std::uint16_t low) {
+      if (low != prev + 1) {
+        pairs.push_back(low);
+        pairs.push_back(0);
+      } else {
+        pairs[pairs.size() - 1]++;
+      }
+      prev = low;
+    });
+    values.swap(pairs);
+    words = vector<std::uint64_t>();
+    type = kRun;
+  }
+
+  size_type memory_usage() const {
+    return sizeof(BitmapChunk) + values.capacity() * sizeof(std::uint16_t) +
+           words.capacity() * sizeof(std::uint64_t);
+  }
+
+  std::uint16_t key;
+  std::uint8_t type;
+  std::uint32_t cardinality;
+  vector<std::uint16_t> values;
+  vector<std::uint64_t> words;
+
+ private:
+  // First array index whose value is not below low.
+  size_type find(std::uint16_t low) const {
+    size_type lo = 0, hi = values.size();
+    while (lo < hi) {
+      size_type mid = (lo + hi) / 2;
+      if (values[mid] < low)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    return lo;
+  }
+};
+
+class BitmapSetIterator {
+ public:
+  using value_type = std::uint32_t;
+  using size_type = std::size_t;
+
+  BitmapSetIterator() : chunks_(nullptr), chunk_(0), low_(0), pos_(0) {}
+
+  BitmapSetIterator(const vector<BitmapChunk> *chunks, size_type chunk)
+      : chunks_(chunks), chunk_(chunk), low_(-1), pos_(0) {
+    advance();
+  }
+
+  bool operator==(const BitmapSetIterator &other) const {
+    return chunk_ == other.chunk_ && low_ == other.low_;
+  }
+
+  bool operator!=(const BitmapSetIterator &other) const {
+    return !(*this == other);
+  }
+
+  value_type operator*() const {
+    return static_cast<value_type>((*chunks_)[chunk_].key) << 16 |
+           static_cast<value_type>(low_);
+  }
+
+  BitmapSetIterator &operator++() {
+    advance();
+    return *this;
+  }
+
+  BitmapSetIterator operator++(int) {
+    BitmapSetIterator it = *this;
+    advance();
+    return it;
+  }
+
+ private:
+  void advance() {
+    while (chunk_ < chunks_->size()) {
+      low_ = (*chunks_)[chunk_].next(low_ + 1, pos_);
+      if (low_ >= 0) return;
+      chunk_++;
+      pos_ = 0;
+    }
+    low_ = -1;
+  }
+
+  const vector<BitmapChunk> *chunks_;
+  size_type chunk_;
+  int low_;
+  size_type pos_;
+};
+
+// Compressed set of 32-bit integers in the style of Roaring bitmaps: values
+// are grouped by their upper 16 bits into chunks, each an array, a bitmap
+// or a list of runs, so dense ranges take about one bit per value instead
+// of a tree node. Union, intersection and difference work chunk by chunk;
+// two bitmap chunks are combined a 64-bit word at a time.
+class bitmap_set {
+ public:
+  using key_type = std::uint32_t;
+  using value_type = std::uint32_t;
+  using size_type = std::size_t;
+  using iterator = BitmapSetIterator;
+  using const_iterator = iterator;
+
+  bitmap_set() {}
+
+  bitmap_set(std::initializer_list<value_type> items) {
+    for (auto it = items.begin(); it != items.end(); ++it) insert(*it);
+  }
+
+  iterator begin() const { return iterator(&chunks_, 0); }
+
+  iterator end() const { return iterator(&chunks_, chunks_.size()); }
+
+  bool empty() const noexcept { return chunks_.empty(); }
+
+  // Number of values, the cardinality of the set.
+  size_type size() const noexcept {
+    size_type res = 0;
+    for (size_type i = 0; i < chunks_.size(); i++) {
+      res += chunks_[i].cardinality;
+    }
+    return res;
+  }
+
+  void clear() noexcept { chunks_ = vector<BitmapChunk>(); }
+
+  bool insert(value_type value) {
+    size_type pos = find_chunk(high(value));
+    if (pos == chunks_.size() || chunks_[pos].key != high(value)) {
+      chunks_.insert(chunks_.cbegin() + pos, BitmapChunk(high(value)));
+    }
+    return chunks_[pos].add(low(value));
+  }
+
+  size_type erase(value_type value) {
+    size_type pos = find_chunk(high(value));
+    if (pos == chunks_.size() || chunks_[pos].key != high(value)) return 0;
+    if (!chunks_[pos].remove(low(value))) return 0;
+    if (!chunks_[pos].cardinality) chunks_.erase(chunks_.cbegin() + pos);
+    return 1;
+  }
+
+  bool contains(value_type value) const {
+    size_type pos = find_chunk(high(value));
+    return pos < chunks_.size() && chunks_[pos].key == high(value) &&
+           chunks_[pos].contains(low(value));
+  }
+
+  void swap(bitmap_set &other) noexcept { chunks_.swap(other.chunks_); }
+
+  // Calls fn(value) for every value in increasing order.
+  template <class Fn>
+  void for_each(Fn fn) const {
+    for (size_type i = 0; i < chunks_.size(); i++) {
+      value_type high = static_cast<value_type>(chunks_[i].key) << 16;
+      chunks_[i].for_each([&fn, high](std::uint16_t low) { fn(high | low); });
+    }
+  }
+
+  // Stores chunks made of long runs of consecutive values as runs.
+  void run_optimize() {
+    for (size_type i = 0; i < chunks_.size(); i++) chunks_[i].run_optimize();
+  }
+
+  // Bytes held by the set, including its own size.
+  size_type memory_usage() const {
+    size_type res = sizeof(*this) +
+                    (chunks_.capacity() - chunks_.size()) * sizeof(BitmapChunk);
+    for (size_type i = 0; i < chunks_.size(); i++) {
+      res += chunks_[i].memory_usage();
+    }
+    return res;
+  }
+
+  bitmap_set &operator|=(const bitmap_set &other) {
+    return *this = combine(*this, other, kOr);
+  }
+
+  bitmap_set &operator&=(const bitmap_set &other) {
+    return *this = combine(*this, other, kAnd);
+  }
+
+  bitmap_set &operator-=(const bitmap_set &other) {
+    return *this = combine(*this, other, kAndNot);
+  }
+
+  friend bitmap_set operator|(const bitmap_set &lhs, const bitmap_set &rhs) {
+    return combine(lhs, rhs, kOr);
+  }
+
+  friend bitmap_set operator&(const bitmap_set &lhs, const bitmap_set &rhs) {
+    return combine(lhs, rhs, kAnd);
+  }
+
+  friend bitmap_set operator-(const bitmap_set &lhs, const bitmap_set &rhs) {
+    return combine(lhs, rhs, kAndNot);
+  }
+
+  friend bool operator==(const bitmap_set &lhs, const bitmap_set &rhs) {
+    if (lhs.chunks_.size() != rhs.chunks_.size()) return false;
+    iterator a = lhs.begin(), b = rhs.begin();
+    for (; a != lhs.end(); ++a, ++b) {
+      if (b == rhs.end() || *a != *b) return false;
+    }
+    return b == rhs.end();
+  }
+
+  friend bool operator!=(const bitmap_set &lhs, const bitmap_set &rhs) {
+    return !(lhs == rhs);
+  }
+
+ private:
+  using chunk = BitmapChunk;
+
+  enum op { kOr, kAnd, kAndNot };
+
+  static std::uint16_t high(value_type value) { return value >> 16; }
+
+  static std::uint16_t low(value_type value) { return value & 0xffff; }
+
+  size_type find_chunk(std::uint16_t key) const {
+    size_type lo = 0, hi = chunks_.size();
+    while (lo < hi) {
+      size_type mid = (lo + hi) / 2;
+      if (chunks_[mid].key < key)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    return lo;
+  }
+
+  // Merges the chunk lists by key; chunks present on one side only are
+  // copied (or dropped) without looking inside.
+  static bitmap_set combine(const bitmap_set &lhs, const bitmap_set &rhs,
+                            op o) {
+    bitmap_set res;
+    const vector<chunk> &a = lhs.chunks_, &b = rhs.chunks_;
+    size_type i = 0, j = 0;
+    while (i < a.size() || j < b.size()) {
+      if (j == b.size() || (i < a.size() && a[i].key < b[j].key)) {
+        if (o != kAnd) res.chunks_.push_back(a[i]);
+        i++;
+      } else if (i == a.size() || b[j].key < a[i].key) {
+        if (o == kOr) res.chunks_.push_back(b[j]);
+        j++;
+      } else {
+        chunk c = combine(a[i++], b[j++], o);
+        if (c.cardinality) res.chunks_.push_back(std::move(c));
+      }
+    }
+    return res;
+  }
+
+  // Works on the chunks in place: an array is only probed or merged, and a
+  // run chunk is expanded, into a copy, only when the other side needs a
+  // bitmap or an array to merge with.
+  static chunk combine(const chunk &x, const chunk &y, op o) {
+    if (x.type == chunk::kBitmap && y.type == chunk::kBitmap) {
+      return combine_bitmaps(x, y, o);
+    }
+    if (x.type == chunk::kArray && y.type == chunk::kArray) {
+      return combine_arrays(x, y, o);
+    }
+    if (o == kAnd && (x.type == chunk::kArray || y.type == chunk::kArray)) {
+      return x.type == chunk::kArray ? filter(x, y, true) : filter(y, x, true);
+    }
+    if (o == kAndNot && x.type == chunk::kArray) return filter(x, y, false);
+    if (x.type == chunk::kRun) return combine(materialized(x), y, o);
+    if (y.type == chunk::kRun) return combine(x, materialized(y), o);
+    // One bitmap, one array: the result starts as the bitmap and the array
+    // values are set or cleared.
+    const chunk &array = x.type == chunk::kArray ? x : y;
+    chunk res = x.type == chunk::kArray ? y : x;
+    for (size_type i = 0; i < array.values.size(); i++) {
+      std::uint16_t v = array.values[i];
+      std::uint64_t &word = res.words[v >> 6];
+      std::uint64_t bit = std::uint64_t(1) << (v & 63);
+      res.cardinality -= (word & bit) != 0;
+      word = o == kOr ? word | bit : word & ~bit;
+      res.cardinality += (word & bit) != 0;
+    }
+    if (res.cardinality <= chunk::kArrayMax) res.to_array();
+    return res;
+  }
+
+  static chunk materialized(const chunk &runs) {
+    chunk res = runs;
+    res.materialize();
+    return res;
+  }
+
+  // The values of array that other holds (keep) or lacks (!keep).
+  static chunk filter(const chunk &array, const chunk &other, bool keep) {
+    chunk res(array.key);
+    for (size_type i = 0; i < array.values.size(); i++) {
+      if (other.contains(array.values[i]) == keep) {
+        res.values.push_back(array.values[i]);
+      }
+    }
+    res.cardinality = static_cast<std::uint32_t>(res.values.size());
+    return res;
+  }
+
+  // One plain word loop per operation, so the compiler vectorizes each;
+  // the cardinality is recounted with popcount afterwards.
+  static chunk combine_bitmaps(const chunk &x, const chunk &y, op o) {
+    chunk res(x.key);
+    res.type = chunk::kBitmap;
+    res.words = vector<std::uint64_t>(chunk::kWords);
+    std::uint64_t *out = res.words.data();
+    const std::uint64_t *a = x.words.data(), *b = y.words.data();
+    switch (o) {
+      case kOr:
+        combine_words(out, a, b, [](auto p, auto q) { return p | q; });
+        break;
+      case kAnd:
+        combine_words(out, a, b, [](auto p, auto q) { return p & q; });
+        break;
+      default:
+        combine_words(out, a, b, [](auto p, auto q) { return p & ~q; });
+    }
+    size_type count = 0;
+    for (size_type w = 0; w < chunk::kWords; w++) {
+      count += __builtin_popcountll(out[w]);
+    }
+    res.cardinality = static_cast<std::uint32_t>(count);
+    if (count <= chunk::kArrayMax) res.to_array();
+    return res;
+  }
+
+  // out is a fresh buffer; saying so spares the loop its alias checks.
+  template <class Fn>
+  static void combine_words(std::uint64_t *__restrict out,
+                            const std::uint64_t *__restrict a,
+                            const std::uint64_t *__restrict b, Fn fn) {
+    for (size_type w = 0; w < chunk::kWords; w++) out[w] = fn(a[w], b[w]);
+  }
+
+  static chunk combine_arrays(const chunk &x, const chunk &y, op o) {
+    chunk res(x.key);
+    const vector<std::uint16_t> &a = x.values, &b = y.values;
+    vector<std::uint16_t> &out = res.values;
+    size_type i = 0, j = 0;
+    while (i < a.size() && j < b.size()) {
+      if (a[i] < b[j]) {
+        if (o != kAnd) out.push_back(a[i]);
+        i++;
+      } else if (b[j] < a[i]) {
+        if (o == kOr) out.push_back(b[j]);
+        j++;
+      } else {
+        if (o != kAndNot) out.push_back(a[i]);
+        i++, j++;
+      }
+    }
+    for (; o != kAnd && i < a.size(); i++) out.push_back(a[i]);
+    for (; o == kOr && j < b.size(); j++) out.push_back(b[j]);
+    res.cardinality = static_cast<std::uint32_t>(out.size());
+    if (res.cardinality > chunk::kArrayMax) res.to_bitmap();
+    return res;
+  }
+
+  vector<chunk> chunks_;
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_BITMAP_SET_H
@@ -0,0 +1,115 @@
+#ifndef S21_CONTAINERS_SRC_S21_BLOOM_FILTER_H
+#define S21_CONTAINERS_SRC_S21_BLOOM_FILTER_H
+
+#include <cstdint>
+#include <functional>
+
+#include "s21_vector.h"
+
+namespace s21 {
+// 64-bit finalizer spreading the bits of a hash value, so that identity
+// hashes (std::hash of integers) can be used as table or bit indices.
+inline std::uint64_t hash_mix(std::uint64_t x) noexcept {
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+// Lookup counters of a bloom_filter placed in front of a container.
+struct bloom_stats {
+  using size_type = std::size_t;
+
+  // Share of the lookups for absent keys that the filter failed to reject.
+  double false_positive_rate() const noexcept {
+    size_type misses = rejected + false_positives;
+    return misses ? static_cast<double>(false_positives) / misses : 0;
+  }
+
+  size_type lookups;
+  size_type rejected;
+  size_type false_positives;
+  // Keys erased from the container since the filter was last rebuilt; their
+  // bits are still set and turn into false positives.
+  size_type erased_since_rebuild;
+};
+
+// Bit array answering "definitely absent" or "maybe present" for a key.
+// Keys can only be added; erased keys are forgotten by clear() and adding
+// the remaining ones again.
+template <class Key, class Hash = std::hash<Key>>
+class bloom_filter {
+ public:
+  using key_type = Key;
+  using size_type = std::size_t;
+
+  // The bit count is rounded up to a power of two (at least 64).
+  explicit bloom_filter(size_type bit_count, size_type hash_count = 3)
+      : bits_(words_for(bit_count)),
+        mask_(bits_.size() * kWordBits - 1),
+        hash_count_(hash_count ? hash_count : 1),
+        stats_() {
+    clear();
+  }
+
+  void insert(const key_type &key) {
+    std::uint64_t h1, h2;
+    hash(key, h1, h2);
+    for (size_type i = 0; i < hash_count_; i++, h1 += h2) {
+      bits_[(h1 & mask_) / kWordBits] |= std::uint64_t(1) << (h1 % kWordBits);
+    }
+  }
+
+  bool might_contain(const key_type &key) const {
+    std::uint64_t h1, h2;
+    hash(key, h1, h2);
+    for (size_type i = 0; i < hash_count_; i++, h1 += h2) {
+      if (!(bits_[(h1 & mask_) / kWordBits] >> (h1 % kWordBits) & 1)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Resets the bits, keeping the size and the counters.
+  void clear() noexcept {
+    for (size_type i = 0; i < bits_.size(); i++) {
+      bits_[i] = 0;
+    }
+    stats_.erased_since_rebuild = 0;
+  }
+
+  size_type bit_count() const noexcept { return mask_ + 1; }
+
+  size_type hash_count() const noexcept { return hash_count_; }
+
+  // Counters are kept by the owning container, lookups are const there.
+  bloom_stats &stats() const noexcept { return stats_; }
+
+ private:
+  static constexpr size_type kWordBits = 64;
+
+  static size_type words_for(size_type bit_count) {
+    size_type words = 1;
+    while (words * kWordBits < bit_count) words *= 2;
+    return words;
+  }
+
+  // Double hashing: the i-th probe is h1 + i * h2, h2 odd so the probes of
+  // one key never collapse onto the same bit.
+  static void hash(const key_type &key, std::uint64_t &h1, std::uint64_t &h2) {
+    std::uint64_t h = Hash()(key);
+    h1 = hash_mix(h);
+    h2 = hash_mix(h + 0x9e3779b97f4a7c15ULL) | 1;
+  }
+
+  vector<std::uint64_t> bits_;
+  size_type mask_;
+  size_type hash_count_;
+  mutable bloom_stats stats_;
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_BLOOM_FILTER_H
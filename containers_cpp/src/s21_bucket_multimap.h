@@ -0,0 +1,299 @@
+#ifndef S21_CONTAINERS_SRC_S21_BUCKET_MULTIMAP_H
+#define S21_CONTAINERS_SRC_S21_BUCKET_MULTIMAP_H
+
+#include <type_traits>
+
+#include "s21_rbtree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+namespace {
+template <class K, class Bucket>
+class BucketMultimapIterator {
+ public:
+  using key_type = K;
+  using value_type = typename Bucket::value_type;
+  using size_type = std::size_t;
+  using tree_iterator = TreeIterator<key_type, Bucket>;
+  using reference = value_type &;
+  using pointer = value_type *;
+
+  BucketMultimapIterator() : it_(), index_(0) {}
+
+  BucketMultimapIterator(const tree_iterator &it, size_type index = 0)
+      : it_(it), index_(index) {}
+
+  bool operator==(const BucketMultimapIterator &other) {
+    return it_ == other.it_ && index_ == other.index_;
+  }
+
+  bool operator!=(const BucketMultimapIterator &other) {
+    return !(*this == other);
+  }
+
+  reference operator*() { return (*it_)[index_]; }
+
+  pointer operator->() { return &(*it_)[index_]; }
+
+  BucketMultimapIterator &operator++() {
+    if (++index_ == (*it_).size()) {
+      index_ = 0;
+      ++it_;
+    }
+    return *this;
+  }
+
+  BucketMultimapIterator &operator--() {
+    if (index_ == 0 || it_.get_pointer() == nullptr) {
+      --it_;
+      index_ = (*it_).size() - 1;
+    } else {
+      --index_;
+    }
+    return *this;
+  }
+
+  BucketMultimapIterator operator++(int) {
+    BucketMultimapIterator it = *this;
+    ++(*this);
+    return it;
+  }
+
+  BucketMultimapIterator operator--(int) {
+    BucketMultimapIterator it = *this;
+    --(*this);
+    return it;
+  }
+
+  key_type get_key() { return it_.get_key(); }
+
+  // Position of the value within the bucket of its key.
+  size_type get_index() const { return index_; }
+
+  tree_iterator get_tree_iterator() const { return it_; }
+
+ private:
+  tree_iterator it_;
+  size_type index_;
+};
+}  // namespace
+
+// Multimap keeping one tree node per distinct key whose value is a vector
+// (bucket) of all values of that key, in insertion order. count() is a
+// single lookup and scanning the values of a key walks one contiguous
+// array, while iterators still visit every (key, value) pair in key order.
+// Tree nodes and buckets both come from Allocator.
+template <class K, class T, class Compare = std::less<K>,
+          class Allocator = std::allocator<std::pair<const K, T>>>
+class bucket_multimap {
+ public:
+  using key_type = K;
+  using value_type = T;
+  using size_type = std::size_t;
+  using allocator_type = Allocator;
+  using bucket_type =
+      vector<value_type, typename std::allocator_traits<
+                             Allocator>::template rebind_alloc<value_type>>;
+  using tree_type = tree<key_type, bucket_type, rb_balance, Allocator>;
+  using iterator = BucketMultimapIterator<key_type, bucket_type>;
+  using const_iterator = iterator;
+
+  bucket_multimap() : size_(0) {}
+
+  explicit bucket_multimap(const allocator_type &alloc)
+      : tree_(alloc), size_(0) {}
+
+  bucket_multimap(const bucket_multimap &other)
+      : tree_(other.tree_), size_(other.size_) {}
+
+  bucket_multimap(bucket_multimap &&other)
+      : tree_(std::move(other.tree_)), size_(other.size_) {
+    other.size_ = 0;
+  }
+
+  bucket_multimap(
+      std::initializer_list<std::pair<const key_type, value_type>> items)
+      : size_(0) {
+    for (auto it = items.begin(); it != items.end(); ++it) {
+      insert(it->first, it->second);
+    }
+  }
+
+  ~bucket_multimap() {}
+
+  // Buckets are copied with the allocator of their tree. When this map
+  // keeps an allocator different from the one of other, the values are
+  // inserted one by one so that new buckets come from this allocator.
+  bucket_multimap &operator=(const bucket_multimap &other) {
+    if (this != &other) {
+      if (alloc_traits::propagate_on_container_copy_assignment::value ||
+          get_allocator() == other.get_allocator()) {
+        tree_ = other.tree_;
+        size_ = other.size_;
+      } else {
+        clear();
+        append(other);
+      }
+    }
+    return *this;
+  }
+
+  bucket_multimap &operator=(bucket_multimap &&other) {
+    if (this != &other) {
+      if (alloc_traits::propagate_on_container_move_assignment::value ||
+          get_allocator() == other.get_allocator()) {
+        tree_ = std::move(other.tree_);
+        size_ = other.size_;
+        other.size_ = 0;
+      } else {
+        clear();
+        append(other);
+        other.clear();
+      }
+    }
+    return *this;
+  }
+
+  iterator begin() noexcept { return iterator(tree_.begin()); }
+
+  iterator end() noexcept { return iterator(tree_.end()); }
+
+  bool empty() const noexcept { return !size_; }
+
+  size_type size() const noexcept { return size_; }
+
+  // Number of different keys, i.e. of buckets.
+  size_type distinct_size() const noexcept { return tree_.size(); }
+
+  void clear() noexcept {
+    tree_.clear();
+    size_ = 0;
+  }
+
+  // Appends value to the bucket of key and returns it.
+  iterator insert(const key_type &key, const value_type &value) {
+    auto res = tree_.find(key);
+    if (!res.get_pointer()) {
+      res = tree_.insert(key, bucket_type(get_allocator())).first;
+    }
+    (*res).push_back(value);
+    size_++;
+    return iterator(res, (*res).size() - 1);
+  }
+
+  // Removes the single value at pos.
+  iterator erase(iterator pos) {
+    auto it = pos.get_tree_iterator();
+    size_type index = pos.get_index();
+    size_--;
+    if ((*it).size() > 1) {
+      (*it).erase((*it).cbegin() + index);
+      if (index < (*it).size()) return iterator(it, index);
+      return iterator(++it);
+    }
+    key_type key = it.get_key();
+    tree_.erase(key);
+    return upper_bound(key);
+  }
+
+  // Removes all values of key and returns their number.
+  size_type erase(const key_type &key) {
+    size_type n = count(key);
+    if (n) {
+      tree_.erase(key);
+      size_ -= n;
+    }
+    return n;
+  }
+
+  void swap(bucket_multimap &other) noexcept {
+    tree_.swap(other.tree_);
+    std::swap(size_, other.size_);
+  }
+
+  void merge(bucket_multimap &source) {
+    append(source);
+    source.clear();
+  }
+
+  // Number of values of key, one O(log n) lookup.
+  size_type count(const key_type &key) const {
+    const bucket_type *b = values(key);
+    return b ? b->size() : 0;
+  }
+
+  // The values of key, contiguous and in insertion order, or nullptr.
+  const bucket_type *values(const key_type &key) const {
+    auto it = tree_.find(key);
+    return it.get_pointer() ? &*it : nullptr;
+  }
+
+  iterator find(const key_type &key) {
+    auto it = tree_.find(key);
+    return it.get_pointer() ? iterator(it) : end();
+  }
+
+  bool contains(const key_type &key) const { return tree_.contains(key); }
+
+  std::pair<iterator, iterator> equal_range(const key_type &key) {
+    return std::make_pair(lower_bound(key), upper_bound(key));
+  }
+
+  iterator lower_bound(const key_type &key) {
+    return iterator(tree_.lower_bound(key));
+  }
+
+  iterator upper_bound(const key_type &key) {
+    return iterator(tree_.upper_bound(key));
+  }
+
+  // Calls fn(key, value) for every pair in key order. If fn returns bool,
+  // false stops the walk.
+  template <class Fn>
+  void for_each(Fn fn) const {
+    tree_.for_each([&fn](const key_type &key, const bucket_type &b) {
+      for (size_type i = 0; i < b.size(); i++) {
+        if constexpr (std::is_same_v<decltype(fn(key, b[i])), bool>) {
+          if (!fn(key, b[i])) return false;
+        } else {
+          fn(key, b[i]);
+        }
+      }
+      return true;
+    });
+  }
+
+  allocator_type get_allocator() const noexcept {
+    return tree_.get_allocator();
+  }
+
+  const tree_type &get_tree() const noexcept { return tree_; }
+
+ private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  void append(const bucket_multimap &source) {
+    source.tree_.for_each([this](const key_type &key, const bucket_type &b) {
+      for (size_type i = 0; i < b.size(); i++) insert(key, b[i]);
+    });
+  }
+
+  tree_type tree_;
+  size_type size_;
+};
+
+template <class K, class T, class C, class A>
+bool operator==(const bucket_multimap<K, T, C, A> &lhs,
+                const bucket_multimap<K, T, C, A> &rhs) {
+  return lhs.size() == rhs.size() && lhs.get_tree() == rhs.get_tree();
+}
+
+template <class K, class T, class C, class A>
+bool operator!=(const bucket_multimap<K, T, C, A> &lhs,
+                const bucket_multimap<K, T, C, A> &rhs) {
+  return !(lhs == rhs);
+}
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_BUCKET_MULTIMAP_H
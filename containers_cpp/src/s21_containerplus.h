@@ -2,6 +2,18 @@
 #define S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_H_
 
 #include "s21_array.h"
+#include "s21_bitmap_set.h"
+#include "s21_bucket_multimap.h"
+#include "s21_counted_multiset.h"
+#include "s21_lru_cache.h"
+#include "s21_multimap.h"
 #include "s21_multiset.h"
+#include "s21_radix_map.h"
+#include "s21_small_vector.h"
+#include "s21_splay_map.h"
+#include "s21_splay_set.h"
+#include "s21_static_vector.h"
+#include "s21_ttl_map.h"
+#include "s21_versioned_map.h"
 
 #endif  // S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_H_
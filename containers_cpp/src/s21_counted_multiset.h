@@ -0,0 +1,266 @@
+#ifndef S21_CONTAINERS_SRC_S21_COUNTED_MULTISET_H
+#define S21_CONTAINERS_SRC_S21_COUNTED_MULTISET_H
+
+#include "s21_rbtree.h"
+
+namespace s21 {
+namespace {
+template <class K>
+class CountedMultisetIterator {
+ public:
+  using key_type = K;
+  using size_type = std::size_t;
+  using tree_iterator = TreeConstIterator<key_type, size_type>;
+  using reference = const key_type &;
+  using pointer = const key_type *;
+
+  CountedMultisetIterator() : it_(), index_(0) {}
+
+  CountedMultisetIterator(const tree_iterator &it, size_type index = 0)
+      : it_(it), index_(index) {}
+
+  bool operator==(const CountedMultisetIterator &other) {
+    return it_ == other.it_ && index_ == other.index_;
+  }
+
+  bool operator!=(const CountedMultisetIterator &other) {
+    return !(*this == other);
+  }
+
+  reference operator*() { return it_.get_pointer()->key; }
+
+  pointer operator->() { return &it_.get_pointer()->key; }
+
+  CountedMultisetIterator &operator++() {
+    if (++index_ == *it_) {
+      index_ = 0;
+      ++it_;
+    }
+    return *this;
+  }
+
+  CountedMultisetIterator &operator--() {
+    if (index_ == 0 || it_.get_pointer() == nullptr) {
+      --it_;
+      index_ = *it_ - 1;
+    } else {
+      --index_;
+    }
+    return *this;
+  }
+
+  CountedMultisetIterator operator++(int) {
+    CountedMultisetIterator it = *this;
+    ++(*this);
+    return it;
+  }
+
+  CountedMultisetIterator operator--(int) {
+    CountedMultisetIterator it = *this;
+    --(*this);
+    return it;
+  }
+
+  key_type get_key() { return it_.get_key(); }
+
+  // Which occurrence of the key the iterator points to, starting from 0.
+  size_type get_index() const { return index_; }
+
+  tree_iterator get_tree_iterator() const { return it_; }
+
+ private:
+  tree_iterator it_;
+  size_type index_;
+};
+}  // namespace
+
+// Multiset that keeps one tree node per distinct key together with the
+// number of its occurrences, so memory grows with the number of distinct
+// keys rather than with size(). Iterators still visit every occurrence.
+// The tree nodes come from Allocator.
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Key>>
+class counted_multiset {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using size_type = std::size_t;
+  using allocator_type = Allocator;
+  using tree_type = tree<key_type, size_type, rb_balance, Allocator>;
+  using iterator = CountedMultisetIterator<key_type>;
+  using const_iterator = iterator;
+
+  counted_multiset() : size_(0) {}
+
+  explicit counted_multiset(const allocator_type &alloc)
+      : tree_(alloc), size_(0) {}
+
+  counted_multiset(const counted_multiset &other)
+      : tree_(other.tree_), size_(other.size_) {}
+
+  counted_multiset(counted_multiset &&other)
+      : tree_(std::move(other.tree_)), size_(other.size_) {
+    other.size_ = 0;
+  }
+
+  counted_multiset(std::initializer_list<value_type> init) : size_(0) {
+    *this = init;
+  }
+
+  ~counted_multiset() {
+    if (tree_.get_root()) {
+      tree_.clear();
+    }
+  }
+
+  counted_multiset &operator=(const counted_multiset &other) {
+    if (this != &other) {
+      tree_.clear();
+      tree_ = other.tree_;
+      size_ = other.size_;
+    }
+    return *this;
+  }
+
+  counted_multiset &operator=(counted_multiset &&other) {
+    if (this != &other) {
+      tree_ = std::move(other.tree_);
+      size_ = other.size_;
+      other.size_ = 0;
+    }
+    return *this;
+  }
+
+  counted_multiset &operator=(std::initializer_list<value_type> ilist) {
+    for (auto it = ilist.begin(); it != ilist.end(); ++it) {
+      insert(*it);
+    }
+    return *this;
+  }
+
+  iterator begin() const noexcept { return cbegin(); }
+
+  const_iterator cbegin() const noexcept { return iterator(tree_.cbegin()); }
+
+  iterator end() const noexcept { return cend(); }
+
+  const_iterator cend() const noexcept { return iterator(tree_.cend()); }
+
+  bool empty() const noexcept { return !size_; }
+
+  size_type size() const noexcept { return size_; }
+
+  // Number of different keys, i.e. of nodes in the tree.
+  size_type distinct_size() const noexcept { return tree_.size(); }
+
+  size_type max_size() const noexcept { return tree_.max_size(); }
+
+  void clear() noexcept {
+    tree_.clear();
+    size_ = 0;
+  }
+
+  iterator insert(const value_type &value) { return insert(value, 1); }
+
+  // Adds n occurrences of value, returns the last of them.
+  iterator insert(const value_type &value, size_type n) {
+    if (!n) return find(value);
+    auto res = tree_.insert(value, n);
+    if (!res.second) *res.first += n;
+    size_ += n;
+    return iterator(res.first, *res.first - 1);
+  }
+
+  void insert(std::initializer_list<value_type> ilist) {
+    for (auto it = ilist.begin(); it != ilist.end(); ++it) {
+      insert(*it);
+    }
+  }
+
+  // Removes the single occurrence at pos.
+  iterator erase(const_iterator pos) {
+    auto it = pos.get_tree_iterator();
+    size_type index = pos.get_index();
+    size_--;
+    if (*it > 1) {
+      --*it;
+      if (index < *it) return iterator(it, index);
+      return iterator(++it);
+    }
+    key_type key = it.get_key();
+    tree_.erase(key);
+    return upper_bound(key);
+  }
+
+  // Removes all occurrences of key and returns their number.
+  size_type erase(const key_type &key) {
+    size_type n = count(key);
+    if (n) {
+      tree_.erase(key);
+      size_ -= n;
+    }
+    return n;
+  }
+
+  void swap(counted_multiset &other) noexcept {
+    tree_.swap(other.tree_);
+    std::swap(size_, other.size_);
+  }
+
+  void merge(counted_multiset &source) {
+    for (auto it = source.tree_.cbegin(); it != source.tree_.cend(); ++it) {
+      insert(it.get_key(), *it);
+    }
+    source.clear();
+  }
+
+  size_type count(const key_type &key) const {
+    auto it = tree_.find(key);
+    return it.get_pointer() ? *it : 0;
+  }
+
+  iterator find(const key_type &key) const {
+    auto it = tree_.find(key);
+    return it.get_pointer() ? iterator(it) : end();
+  }
+
+  bool contains(const key_type &key) const { return tree_.contains(key); }
+
+  std::pair<iterator, iterator> equal_range(const key_type &key) const {
+    return std::make_pair(lower_bound(key), upper_bound(key));
+  }
+
+  iterator lower_bound(const key_type &key) const {
+    return iterator(tree_.lower_bound(key));
+  }
+
+  iterator upper_bound(const key_type &key) const {
+    return iterator(tree_.upper_bound(key));
+  }
+
+  allocator_type get_allocator() const noexcept {
+    return tree_.get_allocator();
+  }
+
+  const tree_type &get_tree() const noexcept { return tree_; }
+
+ private:
+  tree_type tree_;
+  size_type size_;
+};
+
+template <class K, class C, class A>
+bool operator==(const counted_multiset<K, C, A> &lhs,
+                const counted_multiset<K, C, A> &rhs) {
+  return lhs.size() == rhs.size() && lhs.get_tree() == rhs.get_tree();
+}
+
+template <class K, class C, class A>
+bool operator!=(const counted_multiset<K, C, A> &lhs,
+                const counted_multiset<K, C, A> &rhs) {
+  return !(lhs == rhs);
+}
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_COUNTED_MULTISET_H
@@ -1,6 +1,8 @@
 #ifndef S21_CONTAINERS_SRC_S21_DNODE_H_
 #define S21_CONTAINERS_SRC_S21_DNODE_H_
 
+#include <utility>
+
 namespace s21 {
 
 template <typename T>
@@ -0,0 +1,237 @@
+#ifndef S21_CONTAINERS_SRC_S21_FROZEN_TREE_H
+#define S21_CONTAINERS_SRC_S21_FROZEN_TREE_H
+
+#include <stdexcept>
+
+#include "s21_rbtree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+template <class K, class T>
+class frozen_tree;
+
+namespace {
+template <class K, class T>
+class FrozenTreeIterator {
+ public:
+  using key_type = K;
+  using value_type = T;
+  using reference = const value_type &;
+  using pointer = const value_type *;
+  using frozen_type = frozen_tree<key_type, value_type>;
+
+  FrozenTreeIterator() : tree_(nullptr), pos_(0) {}
+
+  FrozenTreeIterator(const frozen_type *tree, size_type pos)
+      : tree_(tree), pos_(pos) {}
+
+  bool operator==(const FrozenTreeIterator &other) const {
+    return tree_ == other.tree_ && pos_ == other.pos_;
+  }
+
+  bool operator!=(const FrozenTreeIterator &other) const {
+    return !(*this == other);
+  }
+
+  reference operator*() const { return tree_->values_[pos_]; }
+
+  pointer operator->() const { return &tree_->values_[pos_]; }
+
+  FrozenTreeIterator &operator++() {
+    pos_ = tree_->next_pos(pos_);
+    return *this;
+  }
+
+  FrozenTreeIterator &operator--() {
+    pos_ = tree_->prev_pos(pos_);
+    return *this;
+  }
+
+  FrozenTreeIterator operator++(int) {
+    FrozenTreeIterator it = *this;
+    ++(*this);
+    return it;
+  }
+
+  FrozenTreeIterator operator--(int) {
+    FrozenTreeIterator it = *this;
+    --(*this);
+    return it;
+  }
+
+  const key_type &get_key() const { return tree_->keys_[pos_]; }
+
+  size_type get_pos() const { return pos_; }
+
+ private:
+  const frozen_type *tree_;
+  size_type pos_;
+};
+}  // namespace
+
+// Immutable search index over the contents of a tree. Keys and values are
+// stored in Eytzinger (BFS) order in two contiguous arrays: the children of
+// slot k are 2k and 2k + 1, slot 0 is unused and doubles as end(). Lookups
+// descend without branching on the comparison result and prefetch the cache
+// line holding the descendants a few levels down.
+template <class K, class T>
+class frozen_tree {
+ public:
+  using key_type = K;
+  using value_type = T;
+  using size_type = std::size_t;
+  using iterator = FrozenTreeIterator<key_type, value_type>;
+  using const_iterator = iterator;
+
+  frozen_tree() : keys_(1), values_(1), size_(0) {}
+
+  template <class Balance, class Allocator>
+  explicit frozen_tree(
+      const tree<key_type, value_type, Balance, Allocator> &source)
+      : keys_(source.size() + 1),
+        values_(source.size() + 1),
+        size_(source.size()) {
+    size_type pos = first_pos();
+    for (auto it = source.cbegin(); it != source.cend(); ++it) {
+      keys_[pos] = it.get_key();
+      values_[pos] = *it;
+      pos = next_pos(pos);
+    }
+  }
+
+  const_iterator begin() const noexcept { return cbegin(); }
+
+  const_iterator cbegin() const noexcept {
+    return const_iterator(this, first_pos());
+  }
+
+  const_iterator end() const noexcept { return cend(); }
+
+  const_iterator cend() const noexcept { return const_iterator(this, 0); }
+
+  bool empty() const noexcept { return !size_; }
+
+  size_type size() const noexcept { return size_; }
+
+  const value_type &at(const key_type &key) const {
+    size_type pos = find_pos(key);
+    if (!pos) {
+      throw std::out_of_range("Key doesn't exist");
+    }
+    return values_[pos];
+  }
+
+  const_iterator find(const key_type &key) const {
+    return const_iterator(this, find_pos(key));
+  }
+
+  bool contains(const key_type &key) const { return find_pos(key) != 0; }
+
+  size_type count(const key_type &key) const {
+    size_type res = 0;
+    size_type last = upper_bound_pos(key);
+    for (size_type pos = lower_bound_pos(key); pos != last;
+         pos = next_pos(pos)) {
+      res++;
+    }
+    return res;
+  }
+
+  const_iterator lower_bound(const key_type &key) const {
+    return const_iterator(this, lower_bound_pos(key));
+  }
+
+  const_iterator upper_bound(const key_type &key) const {
+    return const_iterator(this, upper_bound_pos(key));
+  }
+
+  std::pair<const_iterator, const_iterator> equal_range(
+      const key_type &key) const {
+    return std::make_pair(lower_bound(key), upper_bound(key));
+  }
+
+ private:
+  friend iterator;
+
+  // The descendants of slot k that lie log2(kPrefetchStride) levels below it
+  // are contiguous and start at kPrefetchStride * k, so one prefetch there
+  // covers the next few levels of the descent. Near the leaves that slot is
+  // past the array and nothing is prefetched.
+  static constexpr size_type kPrefetchStride =
+      sizeof(key_type) < 64 ? 64 / sizeof(key_type) : 1;
+
+  void prefetch_below(const key_type *keys, size_type k) const noexcept {
+    if (kPrefetchStride * k <= size_) {
+      __builtin_prefetch(keys + kPrefetchStride * k);
+    }
+  }
+
+  size_type find_pos(const key_type &key) const {
+    size_type pos = lower_bound_pos(key);
+    return (pos && !(key < keys_[pos])) ? pos : 0;
+  }
+
+  size_type lower_bound_pos(const key_type &key) const {
+    const key_type *keys = keys_.data();
+    size_type k = 1;
+    while (k <= size_) {
+      prefetch_below(keys, k);
+      k = 2 * k + (keys[k] < key);
+    }
+    return k >> __builtin_ffsll(~k);
+  }
+
+  size_type upper_bound_pos(const key_type &key) const {
+    const key_type *keys = keys_.data();
+    size_type k = 1;
+    while (k <= size_) {
+      prefetch_below(keys, k);
+      k = 2 * k + !(key < keys[k]);
+    }
+    return k >> __builtin_ffsll(~k);
+  }
+
+  size_type first_pos() const noexcept {
+    if (!size_) return 0;
+    size_type k = 1;
+    while (2 * k <= size_) k = 2 * k;
+    return k;
+  }
+
+  size_type last_pos() const noexcept {
+    if (!size_) return 0;
+    size_type k = 1;
+    while (2 * k + 1 <= size_) k = 2 * k + 1;
+    return k;
+  }
+
+  size_type next_pos(size_type k) const noexcept {
+    if (!k) return 0;
+    if (2 * k + 1 <= size_) {
+      k = 2 * k + 1;
+      while (2 * k <= size_) k = 2 * k;
+      return k;
+    }
+    while (k & 1) k >>= 1;
+    return k >> 1;
+  }
+
+  size_type prev_pos(size_type k) const noexcept {
+    if (!k) return last_pos();
+    if (2 * k <= size_) {
+      k = 2 * k;
+      while (2 * k + 1 <= size_) k = 2 * k + 1;
+      return k;
+    }
+    while (k && !(k & 1)) k >>= 1;
+    return k >> 1;
+  }
+
+  vector<key_type> keys_;
+  vector<value_type> values_;
+  size_type size_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_FROZEN_TREE_H
@@ -3,9 +3,11 @@
 
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <sstream>
 #include <string>
 
+#include "s21_allocator.h"
 #include "s21_dnode.h"
 #include "s21_set.h"
 
@@ -14,14 +16,15 @@ namespace s21 {
 using difference_type = std::ptrdiff_t;
 using size_type = std::size_t;
 
-template <typename T>
+template <typename T, class Allocator = std::allocator<T>>
 class list;
 
 namespace {
 
 template <typename T>
 class ListConstIterator {
-  friend list<T>;
+  template <typename, class>
+  friend class s21::list;
   using iterator_category = std::bidirectional_iterator_tag;
   using node = dnode<T>;
 
@@ -128,16 +131,33 @@ class ListIterator : public ListConstIterator<T> {
 
 }  // namespace
 
-template <typename T>
-class list {
+// Nodes are allocated by Allocator rebound to the node type.
+template <typename T, class Allocator>
+class list : private allocator_holder<typename std::allocator_traits<
+                 Allocator>::template rebind_alloc<dnode<T>>> {
   using iterator = ListIterator<T>;
   using const_iterator = ListConstIterator<T>;
   using node = dnode<T>;
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+  using base = allocator_holder<node_allocator>;
+  using typename base::alloc_traits;
+  using base::alloc;
 
  public:
+  using allocator_type = Allocator;
+
   list() : head_(nullptr), tail_(nullptr), len_(0) {}
 
-  explicit list(size_type size, T value = T()) : list() {
+  explicit list(const allocator_type& alloc)
+      : base(node_allocator(alloc)),
+        head_(nullptr),
+        tail_(nullptr),
+        len_(0) {}
+
+  explicit list(size_type size, T value = T(),
+                const allocator_type& alloc = allocator_type())
+      : list(alloc) {
     check_avail_size_for_nodes(size);
     for (size_type n = 0; n < size; ++n) {
       try {
@@ -149,7 +169,9 @@ class list {
     }
   }
 
-  list(const std::initializer_list<T>& items) : list() {
+  list(const std::initializer_list<T>& items,
+       const allocator_type& alloc = allocator_type())
+      : list(alloc) {
     check_avail_size_for_nodes(items.size());
     for (auto it = items.begin(); it != items.end(); ++it) {
       try {
@@ -161,7 +183,11 @@ class list {
     }
   }
 
-  list(const list& other) : list() {
+  list(const list& other)
+      : list(other, alloc_traits::select_on_container_copy_construction(
+                        other.alloc())) {}
+
+  list(const list& other, const allocator_type& alloc) : list(alloc) {
     check_avail_size_for_nodes(other.size());
     for (auto it = other.cbegin(); it != other.cend(); ++it) {
       try {
@@ -173,37 +199,57 @@ class list {
     }
   }
 
-  list(list&& other) : list() {
+  list(list&& other) : list(allocator_type(other.alloc())) {
     check_avail_size_for_nodes(other.size());
-    swap(other);
+    swap_nodes(other);
   }
 
   list& operator=(const list& other) {
     if (this != &other) {
-      list<T> tmp(other);
-      swap(tmp);
+      constexpr bool propagate =
+          alloc_traits::propagate_on_container_copy_assignment::value;
+      list tmp(other, propagate ? other.get_allocator() : get_allocator());
+      clear();
+      this->copy_alloc(other.alloc());
+      swap_nodes(tmp);
     }
     return *this;
   }
 
+  // Swaps the nodes with other when both allocators can free them. If the
+  // allocators differ, this list is cleared and then takes the nodes with
+  // a propagating allocator, or moves the values into new nodes otherwise.
   list& operator=(list&& other) {
     if (this != &other) {
-      swap(other);
+      if (this->same_alloc(other.alloc())) {
+        swap_nodes(other);
+      } else if (alloc_traits::propagate_on_container_move_assignment::
+                     value) {
+        clear();
+        this->move_alloc(other.alloc());
+        swap_nodes(other);
+      } else {
+        clear();
+        for (auto it = other.begin(); it != other.end(); ++it) {
+          push_back(std::move(*it));
+        }
+        other.clear();
+      }
     }
     return *this;
   }
 
   list& operator=(std::initializer_list<T> ilist) {
-    list<T> tmp(ilist);
-    swap(tmp);
+    list tmp(ilist, get_allocator());
+    swap_nodes(tmp);
     return *this;
   }
 
   ~list() noexcept { clear(); }
 
   void assign(size_type count, const T& value) {
-    clear();
-    *this = std::move(list(count, value));
+    list tmp(count, value, get_allocator());
+    swap_nodes(tmp);
   }
 
   template <class InputIterator>
@@ -247,7 +293,9 @@ class list {
   size_type size() const noexcept { return len_; }
 
   size_type max_size() const noexcept {
-    return std::numeric_limits<size_type>::max() / sizeof(node);
+    return std::min<size_type>(
+        std::numeric_limits<size_type>::max() / sizeof(node),
+        alloc_traits::max_size(alloc()));
   }
 
   void clear() noexcept {
@@ -261,7 +309,7 @@ class list {
       push_back(value);
       return end();
     }
-    auto new_node = new node(value);
+    auto new_node = create_node(value);
     auto prev = curr->detach_prev();
     if (prev) {
       prev->attach_next(new_node);
@@ -325,7 +373,7 @@ class list {
     auto prev = curr->prev;
     auto next = curr->next;
     prev->attach_next(next);
-    delete curr;
+    destroy_node(curr);
     len_--;
     return iterator(next);
   }
@@ -340,7 +388,7 @@ class list {
   }
 
   void push_back(const T& value) {
-    auto last = new node(value);
+    auto last = create_node(value);
     if (tail_) {
       tail_->attach_next(last);
       tail_ = last;
@@ -358,7 +406,7 @@ class list {
   void pop_back() {
     if (tail_) {
       auto prev_tail = tail_->detach_prev();
-      delete tail_;
+      destroy_node(tail_);
       tail_ = prev_tail;
       len_--;
       if (!len_) {
@@ -368,7 +416,7 @@ class list {
   }
 
   void push_front(const T& value) {
-    auto first = new node(value);
+    auto first = create_node(value);
     if (head_) {
       head_->attach_prev(first);
       head_ = first;
@@ -386,7 +434,7 @@ class list {
   void pop_front() {
     if (head_) {
       auto head_next = head_->detach_next();
-      delete head_;
+      destroy_node(head_);
       head_ = head_next;
       len_--;
       if (!len_) {
@@ -399,7 +447,7 @@ class list {
     size_type siz = size();
     if (count != siz) {
       if (count > siz) {
-        list lst = list(count - siz);
+        list lst(count - siz, T(), get_allocator());
         for (auto node : lst) {
           push_back(node.data);
         }
@@ -411,10 +459,15 @@ class list {
     }
   }
 
+  // The allocators are exchanged only if they propagate on swap; otherwise
+  // they must compare equal.
   void swap(list& other) noexcept {
-    std::swap(head_, other.head_);
-    std::swap(tail_, other.tail_);
-    std::swap(len_, other.len_);
+    this->swap_alloc(other.alloc());
+    swap_nodes(other);
+  }
+
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(alloc());
   }
 
   void merge(list& other) {
@@ -471,7 +524,7 @@ class list {
   void sort() {
     if (head_ == nullptr || head_->next == nullptr) return;
 
-    s21::list<T> other;
+    list other(get_allocator());
     auto it = begin();
     size_t len = len_;
 
@@ -488,26 +541,26 @@ class list {
     this->merge(other);
   }
 
-  template <class U>
-  friend std::ostream& operator<<(std::ostream& os, list<U> const& lst);
+  template <class U, class A>
+  friend std::ostream& operator<<(std::ostream& os, list<U, A> const& lst);
 
-  template <class U>
-  friend bool operator==(const list<U>& lhs, const list<U>& rhs);
+  template <class U, class A>
+  friend bool operator==(const list<U, A>& lhs, const list<U, A>& rhs);
 
-  template <class U>
-  friend bool operator!=(const list<U>& lhs, const list<U>& rhs);
+  template <class U, class A>
+  friend bool operator!=(const list<U, A>& lhs, const list<U, A>& rhs);
 
-  template <class U>
-  friend bool operator<(const list<U>& lhs, const list<U>& rhs);
+  template <class U, class A>
+  friend bool operator<(const list<U, A>& lhs, const list<U, A>& rhs);
 
-  template <class U>
-  friend bool operator<=(const list<U>& lhs, const list<U>& rhs);
+  template <class U, class A>
+  friend bool operator<=(const list<U, A>& lhs, const list<U, A>& rhs);
 
-  template <class U>
-  friend bool operator>(const list<U>& lhs, const list<U>& rhs);
+  template <class U, class A>
+  friend bool operator>(const list<U, A>& lhs, const list<U, A>& rhs);
 
-  template <class U>
-  friend bool operator>=(const list<U>& lhs, const list<U>& rhs);
+  template <class U, class A>
+  friend bool operator>=(const list<U, A>& lhs, const list<U, A>& rhs);
 
  private:
   void nullify() noexcept {
@@ -516,6 +569,28 @@ class list {
     len_ = 0;
   }
 
+  void swap_nodes(list& other) noexcept {
+    std::swap(head_, other.head_);
+    std::swap(tail_, other.tail_);
+    std::swap(len_, other.len_);
+  }
+
+  node* create_node(const T& value) {
+    node* created = alloc_traits::allocate(alloc(), 1);
+    try {
+      alloc_traits::construct(alloc(), created, value);
+    } catch (...) {
+      alloc_traits::deallocate(alloc(), created, 1);
+      throw;
+    }
+    return created;
+  }
+
+  void destroy_node(node* removed) noexcept {
+    alloc_traits::destroy(alloc(), removed);
+    alloc_traits::deallocate(alloc(), removed, 1);
+  }
+
   void clear_nodes(size_type nodes) noexcept {
     if (nodes) {
       for (size_type n = 0; n < nodes; ++n) {
@@ -540,8 +615,8 @@ class list {
   size_type len_;
 };
 
-template <typename T>
-std::ostream& operator<<(std::ostream& os, const list<T>& lst) {
+template <typename T, class A>
+std::ostream& operator<<(std::ostream& os, const list<T, A>& lst) {
   os << "[";
   auto an = lst.cbegin();
   for (auto n = lst.cbegin(), e = lst.cend(); n != e; ++n) {
@@ -555,15 +630,15 @@ std::ostream& operator<<(std::ostream& os, const list<T>& lst) {
   return os;
 }
 
-template <typename T>
-std::string to_string(list<T> const& lst) {
+template <typename T, class A>
+std::string to_string(list<T, A> const& lst) {
   std::ostringstream os;
   os << lst;
   return os.str();
 }
 
-template <typename T>
-bool operator==(const list<T>& lhs, const list<T>& rhs) {
+template <typename T, class A>
+bool operator==(const list<T, A>& lhs, const list<T, A>& rhs) {
   if (lhs.size() != rhs.size()) return false;
   auto lit = lhs.cbegin();
   for (auto rit = rhs.cbegin(); rit != rhs.cend(); ++rit) {
@@ -573,13 +648,13 @@ bool operator==(const list<T>& lhs, const list<T>& rhs) {
   return true;
 }
 
-template <typename T>
-bool operator!=(const list<T>& lhs, const list<T>& rhs) {
+template <typename T, class A>
+bool operator!=(const list<T, A>& lhs, const list<T, A>& rhs) {
   return !(lhs == rhs);
 }
 
-template <class T>
-bool operator<(const list<T>& lhs, const list<T>& rhs) {
+template <class T, class A>
+bool operator<(const list<T, A>& lhs, const list<T, A>& rhs) {
   size_type min_size = std::min(lhs.size(), rhs.size());
   auto lit = lhs.cbegin();
   auto rit = rhs.cbegin();
@@ -595,13 +670,13 @@ bool operator<(const list<T>& lhs, const list<T>& rhs) {
   return lhs.size() < rhs.size();
 }
 
-template <class T>
-bool operator<=(const list<T>& lhs, const list<T>& rhs) {
+template <class T, class A>
+bool operator<=(const list<T, A>& lhs, const list<T, A>& rhs) {
   return !(lhs > rhs);
 }
 
-template <class T>
-bool operator>(const list<T>& lhs, const list<T>& rhs) {
+template <class T, class A>
+bool operator>(const list<T, A>& lhs, const list<T, A>& rhs) {
   size_type min_size = std::min(lhs.size(), rhs.size());
   auto lit = lhs.cbegin();
   auto rit = rhs.cbegin();
@@ -617,8 +692,8 @@ bool operator>(const list<T>& lhs, const list<T>& rhs) {
   return lhs.size() > rhs.size();
 }
 
-template <class T>
-bool operator>=(const list<T>& lhs, const list<T>& rhs) {
+template <class T, class A>
+bool operator>=(const list<T, A>& lhs, const list<T, A>& rhs) {
   return !(lhs < rhs);
 }
 
@@ -0,0 +1,277 @@
+#ifndef S21_CONTAINERS_SRC_S21_LRU_CACHE_H
+#define S21_CONTAINERS_SRC_S21_LRU_CACHE_H
+
+#include <new>
+
+#include "s21_dnode.h"
+#include "s21_rbtree.h"
+
+namespace s21 {
+// Hit, miss and eviction counters of an lru_cache.
+struct lru_stats {
+  using size_type = std::size_t;
+
+  double hit_rate() const noexcept {
+    size_type lookups = hits + misses;
+    return lookups ? static_cast<double>(hits) / lookups : 0;
+  }
+
+  size_type hits;
+  size_type misses;
+  size_type evictions;
+};
+
+// Cache holding at most max_count entries and max_bytes bytes, evicting the
+// least recently used entries first. Entries live in one intrusive recency
+// list of dnodes indexed by a tree, so a hit is one O(log n) lookup and a
+// few pointer swaps. Evicted and erased entries are destroyed right away,
+// but the memory of up to max_count of their list nodes and index nodes is
+// kept for reuse, so a cache that has filled up no longer allocates.
+template <class K, class V>
+class lru_cache {
+ public:
+  using key_type = K;
+  using value_type = V;
+  using size_type = std::size_t;
+
+  // A max_bytes of 0 means no byte limit.
+  explicit lru_cache(size_type max_count, size_type max_bytes = 0)
+      : list_pool_(sizeof(node_type), max_count),
+        index_pool_(sizeof(tree_node_t<key_type, node_type *, rb_balance>),
+                    max_count),
+        index_(index_allocator(&index_pool_)),
+        head_(nullptr),
+        tail_(nullptr),
+        max_count_(max_count),
+        max_bytes_(max_bytes),
+        bytes_(0),
+        stats_() {}
+
+  lru_cache(const lru_cache &other) : lru_cache(0) { *this = other; }
+
+  lru_cache(lru_cache &&other) : lru_cache(0) { swap(other); }
+
+  ~lru_cache() { clear(); }
+
+  lru_cache &operator=(const lru_cache &other) {
+    if (this != &other) {
+      clear();
+      set_capacity(other.max_count_, other.max_bytes_);
+      for (node_type *node = other.tail_; node != nullptr; node = node->prev) {
+        put(node->data.key, node->data.value, node->data.bytes);
+      }
+      stats_ = other.stats_;
+    }
+    return *this;
+  }
+
+  lru_cache &operator=(lru_cache &&other) {
+    swap(other);
+    return *this;
+  }
+
+  bool empty() const noexcept { return index_.empty(); }
+
+  size_type size() const noexcept { return index_.size(); }
+
+  size_type bytes() const noexcept { return bytes_; }
+
+  size_type max_count() const noexcept { return max_count_; }
+
+  size_type max_bytes() const noexcept { return max_bytes_; }
+
+  // Value of key, now the most recently used entry, or nullptr on a miss.
+  // The pointer stays valid until the entry is evicted or erased.
+  value_type *get(const key_type &key) {
+    node_type *node = find_node(key);
+    if (node == nullptr) {
+      stats_.misses++;
+      return nullptr;
+    }
+    stats_.hits++;
+    move_to_front(node);
+    return &node->data.value;
+  }
+
+  // Looks key up without counting the access or refreshing the entry.
+  bool contains(const key_type &key) const {
+    return find_node(key) != nullptr;
+  }
+
+  // Inserts or replaces key, charging bytes against max_bytes, and evicts
+  // least recently used entries until the limits hold again. Returns false
+  // if the entry alone is over the limits and was not kept.
+  bool put(const key_type &key, const value_type &value,
+           size_type bytes = sizeof(key_type) + sizeof(value_type)) {
+    if (!max_count_ || (max_bytes_ && bytes > max_bytes_)) {
+      erase(key);
+      return false;
+    }
+    node_type *node = find_node(key);
+    if (node != nullptr) {
+      bytes_ = bytes_ - node->data.bytes + bytes;
+      node->data.value = value;
+      node->data.bytes = bytes;
+      move_to_front(node);
+      evict(node);
+      return true;
+    }
+    while (size() >= max_count_ || (max_bytes_ && bytes_ + bytes > max_bytes_))
+      evict_last();
+    node = acquire_node(key, value, bytes);
+    try {
+      index_.insert(key, node);
+    } catch (...) {
+      release_node(node);
+      throw;
+    }
+    push_front(node);
+    bytes_ += bytes;
+    return true;
+  }
+
+  bool erase(const key_type &key) {
+    node_type *node = find_node(key);
+    if (node == nullptr) return false;
+    index_.erase(key);
+    unlink(node);
+    bytes_ -= node->data.bytes;
+    release_node(node);
+    return true;
+  }
+
+  void clear() noexcept {
+    while (head_ != nullptr) {
+      node_type *node = head_;
+      unlink(node);
+      release_node(node);
+    }
+    index_.clear();
+    bytes_ = 0;
+  }
+
+  // Changes the limits, evicting entries if they no longer fit.
+  void set_capacity(size_type max_count, size_type max_bytes = 0) {
+    max_count_ = max_count;
+    max_bytes_ = max_bytes;
+    evict(nullptr);
+    list_pool_.set_max_free(max_count);
+    index_pool_.set_max_free(max_count);
+  }
+
+  // The pools trade their blocks too; any pool frees any block of its size,
+  // so the index nodes need not follow their allocator.
+  void swap(lru_cache &other) noexcept {
+    list_pool_.swap(other.list_pool_);
+    index_pool_.swap(other.index_pool_);
+    index_.swap(other.index_);
+    std::swap(head_, other.head_);
+    std::swap(tail_, other.tail_);
+    std::swap(max_count_, other.max_count_);
+    std::swap(max_bytes_, other.max_bytes_);
+    std::swap(bytes_, other.bytes_);
+    std::swap(stats_, other.stats_);
+  }
+
+  // Calls fn(key, value) from the most to the least recently used entry.
+  template <class Fn>
+  void for_each(Fn fn) const {
+    for (node_type *node = head_; node != nullptr; node = node->next) {
+      fn(node->data.key, node->data.value);
+    }
+  }
+
+  const lru_stats &get_stats() const noexcept { return stats_; }
+
+  void reset_stats() noexcept { stats_ = lru_stats(); }
+
+ private:
+  struct entry {
+    key_type key;
+    value_type value;
+    size_type bytes;
+  };
+  using node_type = dnode<entry>;
+  using index_allocator =
+      pool_allocator<std::pair<const key_type, node_type *>>;
+  using index_type =
+      tree<key_type, node_type *, rb_balance, index_allocator>;
+
+  node_type *find_node(const key_type &key) const {
+    auto it = index_.find(key);
+    return it.get_pointer() ? *it : nullptr;
+  }
+
+  void push_front(node_type *node) noexcept {
+    node->prev = nullptr;
+    node->next = head_;
+    if (head_ != nullptr)
+      head_->prev = node;
+    else
+      tail_ = node;
+    head_ = node;
+  }
+
+  void unlink(node_type *node) noexcept {
+    if (node->prev != nullptr)
+      node->prev->next = node->next;
+    else
+      head_ = node->next;
+    if (node->next != nullptr)
+      node->next->prev = node->prev;
+    else
+      tail_ = node->prev;
+  }
+
+  void move_to_front(node_type *node) noexcept {
+    if (node == head_) return;
+    unlink(node);
+    push_front(node);
+  }
+
+  // Evicts from the tail until the limits hold, but never keep.
+  void evict(node_type *keep) {
+    while (tail_ != nullptr && tail_ != keep &&
+           (size() > max_count_ || (max_bytes_ && bytes_ > max_bytes_)))
+      evict_last();
+  }
+
+  void evict_last() {
+    node_type *node = tail_;
+    index_.erase(node->data.key);
+    unlink(node);
+    bytes_ -= node->data.bytes;
+    release_node(node);
+    stats_.evictions++;
+  }
+
+  // The entry is built before any memory is taken, so a throwing copy of
+  // the key or value leaves the cache as it was.
+  node_type *acquire_node(const key_type &key, const value_type &value,
+                          size_type bytes) {
+    entry data{key, value, bytes};
+    return new (list_pool_.allocate()) node_type(std::move(data));
+  }
+
+  // Destroys the entry; the pool keeps the memory unless max_count nodes
+  // are already waiting.
+  void release_node(node_type *node) noexcept {
+    node->~node_type();
+    list_pool_.deallocate(node);
+  }
+
+  // Declared before index_, which returns its nodes to index_pool_ when it
+  // is destroyed.
+  node_pool list_pool_;
+  node_pool index_pool_;
+  index_type index_;
+  node_type *head_;
+  node_type *tail_;
+  size_type max_count_;
+  size_type max_bytes_;
+  size_type bytes_;
+  lru_stats stats_;
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_LRU_CACHE_H
@@ -1,10 +1,15 @@
 #ifndef S21_CONTAINERS_SRC_S21_MAP_H
 #define S21_CONTAINERS_SRC_S21_MAP_H
 
+#include <stdexcept>
+
+#include "s21_frozen_tree.h"
 #include "s21_rbtree.h"
 
 namespace s21 {
-template <class K, class T, class Compare = std::less<K>>
+template <class K, class T, class Compare = std::less<K>,
+          class Allocator = std::allocator<std::pair<const K, T>>,
+          class Balance = rb_balance>
 class map {
  public:
   using key_type = K;
@@ -14,17 +19,19 @@ class map {
   using iterator = TreeIterator<key_type, value_type>;
   using const_iterator = TreeConstIterator<key_type, value_type>;
   using node_type = Node<key_type, value_type>;
-  using tree_type = tree<key_type, value_type>;
+  using tree_type = tree<key_type, value_type, Balance, Allocator>;
+  using balance_type = Balance;
+  using allocator_type = Allocator;
+  using frozen_type = frozen_tree<key_type, value_type>;
   using reference = T&;
 
   map() {}
 
-  map(const map& other) { tree_ = other.tree_; }
+  explicit map(const allocator_type& alloc) : tree_(alloc) {}
 
-  map(map&& other) {
-    tree_ = std::move(other.tree_);
-    other.clear();
-  }
+  map(const map& other) : tree_(other.tree_) {}
+
+  map(map&& other) noexcept : tree_(std::move(other.tree_)) {}
 
   map(std::initializer_list<pair_type> const& items) { *this = items; }
 
@@ -115,6 +122,7 @@ class map {
     if (contains(k)) {
       iterator it = find(k);
       *it = obj;
+      tree_.refresh_merkle(k);
       return std::make_pair(find(k), false);
     }
     return insert(k, obj);
@@ -153,7 +161,7 @@ class map {
   void swap(map& other) noexcept { tree_.swap(other.tree_); }
 
   node_type extract(const_iterator position) {
-    return extract(position.get_key());
+    return tree_.extract(position);
   }
 
   node_type extract(const key_type& k) {
@@ -171,12 +179,27 @@ class map {
 
   size_type count(const key_type& key) const { return tree_.count(key); }
 
+  // A lookup on a non-const splay container moves the key found towards the
+  // root; const lookups leave the tree as it is and may run concurrently.
   iterator find(const key_type& key) { return iterator(tree_.find(key)); }
 
   const_iterator find(const key_type& key) const { return tree_.find(key); }
 
+  bool contains(const key_type& key) { return tree_.contains(key); }
+
   bool contains(const key_type& key) const { return tree_.contains(key); }
 
+  template <class ForwardIt, class OutputIt>
+  OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out) const {
+    return tree_.find_many(first, last, out);
+  }
+
+  template <class ForwardIt, class OutputIt>
+  OutputIt contains_many(ForwardIt first, ForwardIt last,
+                         OutputIt out) const {
+    return tree_.contains_many(first, last, out);
+  }
+
   std::pair<iterator, iterator> equal_range(const key_type& key) {
     return tree_.equal_range(key);
   }
@@ -193,39 +216,114 @@ class map {
     return tree_.upper_bound(key);
   }
 
-  tree_type get_tree() const noexcept { return tree_; }
+  // Calls fn(key, value) for every element in key order, or for keys in
+  // [lo, hi). If fn returns bool, false stops the walk.
+  template <class Fn>
+  void for_each(Fn fn) { tree_.for_each(fn); }
+
+  template <class Fn>
+  void for_each(Fn fn) const { tree_.for_each(fn); }
+
+  template <class Fn>
+  void for_each_in_range(const key_type& lo, const key_type& hi, Fn fn) {
+    tree_.for_each_in_range(lo, hi, fn);
+  }
+
+  template <class Fn>
+  void for_each_in_range(const key_type& lo, const key_type& hi,
+                         Fn fn) const {
+    tree_.for_each_in_range(lo, hi, fn);
+  }
+
+  // Appends all keys, in order, to out.
+  void copy_keys_to(vector<key_type>& out) const {
+    out.reserve(out.size() + size());
+    tree_.for_each([&out](const key_type& key, const value_type&) {
+      out.push_back(key);
+    });
+  }
+
+  // Relocates the nodes into one contiguous buffer in key order, see
+  // tree::compact(). Invalidates iterators.
+  void compact() { tree_.compact(); }
+
+  // Bloom filter in front of find/contains/count, see
+  // tree::enable_bloom_filter().
+  void enable_bloom_filter(size_type bit_count, size_type hash_count = 3) {
+    tree_.enable_bloom_filter(bit_count, hash_count);
+  }
+
+  void disable_bloom_filter() noexcept { tree_.disable_bloom_filter(); }
+
+  void rebuild_bloom_filter() { tree_.rebuild_bloom_filter(); }
+
+  bloom_stats get_bloom_stats() const noexcept {
+    return tree_.get_bloom_stats();
+  }
+
+  // Keeps a hash of every subtree, see tree::enable_merkle(); only for a
+  // Balance of the form merkle<...>. Comparing replicas then fails fast on a
+  // hash mismatch, and diff() descends only into the key ranges that differ.
+  void enable_merkle() { tree_.enable_merkle(); }
+
+  void disable_merkle() noexcept { tree_.disable_merkle(); }
+
+  // Call after changing the value of key through a reference (operator[],
+  // at(), iterators) while the Merkle augmentation is on.
+  void refresh_merkle(const key_type& key) { tree_.refresh_merkle(key); }
+
+  std::size_t merkle_hash() const noexcept { return tree_.merkle_hash(); }
+
+  // Keys whose entries differ between the two containers, in order.
+  vector<key_type> diff(const map& other) const {
+    vector<key_type> keys;
+    tree_.diff(other.tree_, [&keys](const key_type& key) {
+      keys.push_back(key);
+    });
+    return keys;
+  }
+
+  frozen_type freeze() const { return frozen_type(tree_); }
+
+  allocator_type get_allocator() const noexcept {
+    return tree_.get_allocator();
+  }
+
+  const tree_type& get_tree() const noexcept { return tree_; }
+
+  tree_type* get_tree_ptr() noexcept { return &tree_; }
 
  protected:
   tree_type tree_;
 };
 
-template <class K, class T>
-bool operator==(const map<K, T>& lhs, const map<K, T>& rhs) {
+template <class K, class T, class C, class A, class B>
+bool operator==(const map<K, T, C, A, B>& lhs, const map<K, T, C, A, B>& rhs) {
   return lhs.get_tree() == rhs.get_tree();
 }
 
-template <class K, class T>
-bool operator!=(const map<K, T>& lhs, const map<K, T>& rhs) {
+template <class K, class T, class C, class A, class B>
+bool operator!=(const map<K, T, C, A, B>& lhs, const map<K, T, C, A, B>& rhs) {
   return !(lhs == rhs);
 }
 
-template <class K, class T>
-bool operator<(const map<K, T>& lhs, const map<K, T>& rhs) {
+template <class K, class T, class C, class A, class B>
+bool operator<(const map<K, T, C, A, B>& lhs, const map<K, T, C, A, B>& rhs) {
   return lhs.get_tree() < rhs.get_tree();
 }
 
-template <class K, class T>
-bool operator<=(const map<K, T>& lhs, const map<K, T>& rhs) {
+template <class K, class T, class C, class A, class B>
+bool operator<=(const map<K, T, C, A, B>& lhs, const map<K, T, C, A, B>& rhs) {
   return lhs.get_tree() <= rhs.get_tree();
 }
 
-template <class K, class T>
-bool operator>(const map<K, T>& lhs, const map<K, T>& rhs) {
+template <class K, class T, class C, class A, class B>
+bool operator>(const map<K, T, C, A, B>& lhs, const map<K, T, C, A, B>& rhs) {
   return lhs.get_tree() > rhs.get_tree();
 }
 
-template <class K, class T>
-bool operator>=(const map<K, T>& lhs, const map<K, T>& rhs) {
+template <class K, class T, class C, class A, class B>
+bool operator>=(const map<K, T, C, A, B>& lhs, const map<K, T, C, A, B>& rhs) {
   return lhs.get_tree() >= rhs.get_tree();
 }
 
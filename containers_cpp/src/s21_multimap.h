@@ -0,0 +1,109 @@
+#ifndef S21_CONTAINERS_SRC_S21_MULTIMAP_H
+#define S21_CONTAINERS_SRC_S21_MULTIMAP_H
+
+#include "s21_map.h"
+
+namespace s21 {
+// Map allowing several values per key, one tree node per value. Values of
+// equal keys are kept in insertion order. See bucket_multimap for a layout
+// keeping the values of one key contiguous.
+template <class K, class T, class Compare = std::less<K>,
+          class Allocator = std::allocator<std::pair<const K, T>>,
+          class Balance = rb_balance>
+class multimap : public s21::map<K, T, Compare, Allocator, Balance> {
+  using base = s21::map<K, T, Compare, Allocator, Balance>;
+
+ public:
+  using key_type = K;
+  using value_type = T;
+  using pair_type = std::pair<const key_type, T>;
+  using size_type = std::size_t;
+  using iterator = typename base::iterator;
+  using const_iterator = typename base::const_iterator;
+
+  multimap() : base() { this->get_tree_ptr()->set_is_multi(true); }
+
+  explicit multimap(const Allocator& alloc) : base(alloc) {
+    this->get_tree_ptr()->set_is_multi(true);
+  }
+
+  multimap(const multimap& other) : base(other) {}
+
+  multimap(multimap&& other) : base(std::move(other)) {}
+
+  multimap(std::initializer_list<pair_type> const& items) {
+    this->get_tree_ptr()->set_is_multi(true);
+    *this = items;
+  }
+
+  multimap& operator=(const multimap& other) {
+    base::operator=(other);
+    return *this;
+  }
+
+  multimap& operator=(multimap&& other) noexcept {
+    base::operator=(std::move(other));
+    return *this;
+  }
+
+  multimap& operator=(std::initializer_list<pair_type> ilist) {
+    for (auto it = ilist.begin(); it != ilist.end(); ++it) {
+      insert(*it);
+    }
+    return *this;
+  }
+
+  // Always inserts; returns the new element, placed after the values
+  // already stored for key.
+  iterator insert(const key_type& key, const value_type& obj) {
+    return base::insert(key, obj).first;
+  }
+
+  iterator insert(const pair_type& value) {
+    return insert(value.first, value.second);
+  }
+
+  void insert(std::initializer_list<pair_type> ilist) {
+    for (auto it = ilist.begin(); it != ilist.end(); ++it) {
+      insert(*it);
+    }
+  }
+
+  // Number of values of key, O(log n + count).
+  size_type count(const key_type& key) const {
+    return this->get_tree().count_multi(key);
+  }
+
+  std::pair<const_iterator, const_iterator> equal_range(
+      const key_type& key) const {
+    return std::make_pair(this->lower_bound(key), this->upper_bound(key));
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type& key) {
+    return base::equal_range(key);
+  }
+
+  // Calls fn(value) for the values of key in insertion order. If fn
+  // returns bool, false stops the walk.
+  template <class Fn>
+  void for_each_value(const key_type& key, Fn fn) const {
+    const_iterator last = this->upper_bound(key);
+    for (const_iterator it = this->lower_bound(key); it != last; ++it) {
+      if constexpr (std::is_same_v<decltype(fn(*it)), bool>) {
+        if (!fn(*it)) break;
+      } else {
+        fn(*it);
+      }
+    }
+  }
+
+  void merge(multimap& source) {
+    source.for_each([this](const key_type& key, const value_type& value) {
+      insert(key, value);
+    });
+    source.clear();
+  }
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_MULTIMAP_H
@@ -4,11 +4,12 @@
 #include "s21_set.h"
 
 namespace s21 {
-template <class Key, class Compare = std::less<Key>>
-class multiset : public s21::set<Key, Compare> {
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Key>>
+class multiset : public s21::set<Key, Compare, Allocator, rb_balance> {
   using key_type = Key;
   using value_type = Key;
-  using base = s21::set<key_type, Compare>;
+  using base = s21::set<key_type, Compare, Allocator, rb_balance>;
   using size_type = std::size_t;
   using iterator = TreeIterator<key_type, value_type>;
   using const_iterator = TreeConstIterator<key_type, value_type>;
@@ -16,6 +17,10 @@ class multiset : public s21::set<Key, Compare> {
  public:
   multiset() : base() { this->get_tree_ptr()->set_is_multi(true); }
 
+  explicit multiset(const Allocator& alloc) : base(alloc) {
+    this->get_tree_ptr()->set_is_multi(true);
+  }
+
   multiset(const multiset& other) : base(other) {}
 
   multiset(multiset&& other) : base(std::move(other)) {}
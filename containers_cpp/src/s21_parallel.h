@@ -0,0 +1,391 @@
+#ifndef S21_CONTAINERS_SRC_S21_PARALLEL_H
+#define S21_CONTAINERS_SRC_S21_PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "s21_array.h"
+#include "s21_queue.h"
+#include "s21_vector.h"
+
+// Parallel versions of sort, stable_sort, for_each, transform, reduce and
+// inclusive_scan over the elements of a vector or an array, or over a
+// pointer range. The range is cut into chunks of opts.grain elements that
+// the threads of a pool take one at a time, so uneven chunks balance out.
+namespace s21 {
+namespace parallel {
+
+using size_type = std::size_t;
+
+// Fixed set of threads. A pool of n threads runs work on n - 1 workers and
+// on the thread that called the algorithm, which takes chunks like any
+// worker while it waits; thread_pool(1) therefore runs everything on the
+// caller, and an algorithm called from inside a task cannot deadlock.
+class thread_pool {
+ public:
+  explicit thread_pool(size_type threads = default_threads()) {
+    if (threads == 0) threads = 1;
+    workers_.reserve(threads - 1);
+    for (size_type i = 1; i < threads; i++) {
+      workers_.emplace_back([this] { work(); });
+    }
+  }
+
+  thread_pool(const thread_pool &) = delete;
+
+  thread_pool &operator=(const thread_pool &) = delete;
+
+  // Lets the workers finish the queued tasks, then joins them.
+  ~thread_pool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    ready_.notify_all();
+    for (size_type i = 0; i < workers_.size(); i++) workers_[i].join();
+  }
+
+  // Number of threads work runs on, the caller included.
+  size_type size() const noexcept { return workers_.size() + 1; }
+
+  // Queues task for a worker; with no workers it runs right away.
+  void submit(std::function<void()> task) {
+    if (workers_.empty()) {
+      task();
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      tasks_.push(std::move(task));
+    }
+    ready_.notify_one();
+  }
+
+  // One thread per hardware thread, or one if that is unknown.
+  static size_type default_threads() noexcept {
+    unsigned threads = std::thread::hardware_concurrency();
+    return threads ? threads : 1;
+  }
+
+ private:
+  void work() {
+    for (;;) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ready_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+        if (tasks_.empty()) return;
+        task = std::move(tasks_.front());
+        tasks_.pop();
+      }
+      task();
+    }
+  }
+
+  s21::vector<std::thread> workers_;
+  s21::queue<std::function<void()>> tasks_;
+  std::mutex mutex_;
+  std::condition_variable ready_;
+  bool stopping_ = false;
+};
+
+// Pool the algorithms use unless told otherwise, sized to the machine.
+inline thread_pool &default_pool() {
+  static thread_pool pool;
+  return pool;
+}
+
+// Smallest number of elements worth a task of its own; below it the
+// hand-off costs more than the work.
+inline constexpr size_type default_grain = size_type{1} << 14;
+
+struct options {
+  // Pool to run on; default_pool() when null.
+  thread_pool *pool = nullptr;
+  // Number of elements in one chunk.
+  size_type grain = default_grain;
+};
+
+namespace internal {
+inline thread_pool &pool_of(const options &opts) {
+  return opts.pool ? *opts.pool : default_pool();
+}
+
+inline size_type chunk_count(size_type n, size_type grain) {
+  if (grain == 0) grain = 1;
+  return (n + grain - 1) / grain;
+}
+
+// Calls body(i) for every i in [0, chunks) on the threads of pool and
+// returns once all calls are done. If any call throws, the others still
+// run and the first exception is rethrown here.
+template <class Body>
+void run(thread_pool &pool, size_type chunks, const Body &body) {
+  if (chunks == 0) return;
+  size_type helpers = std::min(pool.size(), chunks) - 1;
+  if (helpers == 0) {
+    for (size_type i = 0; i < chunks; i++) body(i);
+    return;
+  }
+
+  // Shared with the helper tasks, which may only start after the caller
+  // has finished every chunk and returned; such a task sees next past the
+  // end and touches nothing else.
+  struct job {
+    std::atomic<size_type> next{0};
+    size_type done = 0;
+    std::exception_ptr error;
+    std::mutex mutex;
+    std::condition_variable finished;
+  };
+  auto state = std::make_shared<job>();
+  auto drain = [state, chunks, &body] {
+    size_type ran = 0;
+    for (size_type i; (i = state->next++) < chunks; ran++) {
+      try {
+        body(i);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (!state->error) state->error = std::current_exception();
+      }
+    }
+    if (ran) {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      state->done += ran;
+      if (state->done == chunks) state->finished.notify_all();
+    }
+  };
+  for (size_type i = 0; i < helpers; i++) pool.submit(drain);
+  drain();
+
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->finished.wait(lock, [&] { return state->done == chunks; });
+  if (state->error) std::rethrow_exception(state->error);
+}
+
+// Calls body(lo, hi) for consecutive slices of [0, n) of opts.grain
+// elements each.
+template <class Body>
+void run_slices(size_type n, const options &opts, const Body &body) {
+  size_type grain = std::max<size_type>(opts.grain, 1);
+  run(pool_of(opts), chunk_count(n, grain), [&](size_type i) {
+    body(i * grain, std::min(n, (i + 1) * grain));
+  });
+}
+
+// Sorts one piece per thread with sort_piece, then merges neighbouring
+// pieces in rounds until one is left. The merges are stable, so the whole
+// sort is stable when sort_piece is.
+template <class T, class Compare, class SortPiece>
+void sort_pieces(T *first, T *last, Compare comp, const options &opts,
+                 SortPiece sort_piece) {
+  thread_pool &pool = pool_of(opts);
+  size_type n = last - first;
+  size_type pieces =
+      std::min(pool.size(), chunk_count(n, std::max<size_type>(opts.grain, 1)));
+  if (pieces <= 1) {
+    sort_piece(first, last, comp);
+    return;
+  }
+  auto bound = [&](size_type i) { return first + n * i / pieces; };
+  run(pool, pieces,
+      [&](size_type i) { sort_piece(bound(i), bound(i + 1), comp); });
+  for (size_type width = 1; width < pieces; width *= 2) {
+    run(pool, chunk_count(pieces, 2 * width), [&](size_type i) {
+      size_type lo = 2 * width * i;
+      size_type mid = std::min(lo + width, pieces);
+      size_type hi = std::min(lo + 2 * width, pieces);
+      if (mid < hi) std::inplace_merge(bound(lo), bound(mid), bound(hi), comp);
+    });
+  }
+}
+
+template <class C>
+struct is_contiguous : std::false_type {};
+
+template <class T, class G, class A>
+struct is_contiguous<s21::vector<T, G, A>> : std::true_type {};
+
+template <class T, std::size_t N>
+struct is_contiguous<s21::array<T, N>> : std::true_type {};
+
+template <class C>
+using if_contiguous =
+    std::enable_if_t<is_contiguous<std::remove_const_t<C>>::value>;
+}  // namespace internal
+
+// Pointer ranges.
+
+template <class T, class Compare = std::less<>>
+void sort(T *first, T *last, Compare comp = Compare(),
+          const options &opts = options()) {
+  internal::sort_pieces(first, last, comp, opts, [](T *lo, T *hi, Compare c) {
+    std::sort(lo, hi, c);
+  });
+}
+
+template <class T, class Compare = std::less<>>
+void stable_sort(T *first, T *last, Compare comp = Compare(),
+                 const options &opts = options()) {
+  internal::sort_pieces(first, last, comp, opts, [](T *lo, T *hi, Compare c) {
+    std::stable_sort(lo, hi, c);
+  });
+}
+
+// Calls f on every element; f must be safe to call from several threads.
+template <class T, class F>
+void for_each(T *first, T *last, F f, const options &opts = options()) {
+  internal::run_slices(last - first, opts, [&](size_type lo, size_type hi) {
+    for (size_type i = lo; i < hi; i++) f(first[i]);
+  });
+}
+
+// Writes op(first[i]) to d_first[i]; d_first may be first.
+template <class T, class U, class UnaryOp>
+U *transform(const T *first, const T *last, U *d_first, UnaryOp op,
+             const options &opts = options()) {
+  size_type n = last - first;
+  internal::run_slices(n, opts, [&](size_type lo, size_type hi) {
+    for (size_type i = lo; i < hi; i++) d_first[i] = op(first[i]);
+  });
+  return d_first + n;
+}
+
+// Folds the range into init with op. Chunks are folded in parallel and the
+// results combined in order, so op must be associative but need not be
+// commutative.
+template <class T, class U, class BinaryOp = std::plus<>>
+U reduce(const T *first, const T *last, U init, BinaryOp op = BinaryOp(),
+         const options &opts = options()) {
+  size_type n = last - first;
+  size_type grain = std::max<size_type>(opts.grain, 1);
+  size_type chunks = internal::chunk_count(n, grain);
+  if (chunks <= 1 || internal::pool_of(opts).size() == 1) {
+    for (size_type i = 0; i < n; i++) init = op(std::move(init), first[i]);
+    return init;
+  }
+  s21::vector<U> partials(chunks, init);
+  internal::run(internal::pool_of(opts), chunks, [&](size_type c) {
+    size_type lo = c * grain;
+    size_type hi = std::min(n, lo + grain);
+    U acc = first[lo];
+    for (size_type i = lo + 1; i < hi; i++) acc = op(std::move(acc), first[i]);
+    partials[c] = std::move(acc);
+  });
+  for (size_type c = 0; c < chunks; c++) {
+    init = op(std::move(init), std::move(partials[c]));
+  }
+  return init;
+}
+
+// Writes the running fold of the range with op to d_first; d_first may be
+// first. Each chunk is scanned on its own, the chunk totals are carried
+// forward in order, and the carries are then applied to the chunks in
+// parallel, so op must be associative.
+template <class T, class U, class BinaryOp = std::plus<>>
+U *inclusive_scan(const T *first, const T *last, U *d_first,
+                  BinaryOp op = BinaryOp(), const options &opts = options()) {
+  size_type n = last - first;
+  size_type grain = std::max<size_type>(opts.grain, 1);
+  size_type chunks = internal::chunk_count(n, grain);
+  thread_pool &pool = internal::pool_of(opts);
+  auto scan = [&](size_type c) {
+    size_type lo = c * grain;
+    size_type hi = std::min(n, lo + grain);
+    d_first[lo] = first[lo];
+    for (size_type i = lo + 1; i < hi; i++) {
+      d_first[i] = op(d_first[i - 1], first[i]);
+    }
+  };
+  if (chunks <= 1 || pool.size() == 1) {
+    if (n) {
+      d_first[0] = first[0];
+      for (size_type i = 1; i < n; i++) {
+        d_first[i] = op(d_first[i - 1], first[i]);
+      }
+    }
+    return d_first + n;
+  }
+  internal::run(pool, chunks, scan);
+  // Makes the last element of every chunk final; the rest of a chunk then
+  // only needs the last element of the chunk before it.
+  for (size_type c = 1; c < chunks; c++) {
+    size_type last_of = std::min(n, (c + 1) * grain) - 1;
+    d_first[last_of] = op(d_first[c * grain - 1], d_first[last_of]);
+  }
+  internal::run(pool, chunks - 1, [&](size_type c) {
+    size_type lo = (c + 1) * grain;
+    size_type hi = std::min(n, lo + grain);
+    const U &carry = d_first[lo - 1];
+    for (size_type i = lo; i + 1 < hi; i++) d_first[i] = op(carry, d_first[i]);
+  });
+  return d_first + n;
+}
+
+// Whole vectors and arrays.
+
+template <class C, class Compare = std::less<>,
+          class = internal::if_contiguous<C>>
+void sort(C &c, Compare comp = Compare(), const options &opts = options()) {
+  parallel::sort(c.data(), c.data() + c.size(), comp, opts);
+}
+
+template <class C, class Compare = std::less<>,
+          class = internal::if_contiguous<C>>
+void stable_sort(C &c, Compare comp = Compare(),
+                 const options &opts = options()) {
+  parallel::stable_sort(c.data(), c.data() + c.size(), comp, opts);
+}
+
+template <class C, class F, class = internal::if_contiguous<C>>
+void for_each(C &c, F f, const options &opts = options()) {
+  parallel::for_each(c.data(), c.data() + c.size(), f, opts);
+}
+
+// out must hold at least as many elements as in; in and out may be the
+// same container.
+template <class In, class Out, class UnaryOp,
+          class = internal::if_contiguous<In>,
+          class = internal::if_contiguous<Out>>
+void transform(const In &in, Out &out, UnaryOp op,
+               const options &opts = options()) {
+  if (out.size() < in.size()) {
+    throw std::length_error("output is shorter than input");
+  }
+  parallel::transform(in.data(), in.data() + in.size(), out.data(), op, opts);
+}
+
+template <class C, class U, class BinaryOp = std::plus<>,
+          class = internal::if_contiguous<C>>
+U reduce(const C &c, U init, BinaryOp op = BinaryOp(),
+         const options &opts = options()) {
+  return parallel::reduce(c.data(), c.data() + c.size(), std::move(init), op,
+                          opts);
+}
+
+template <class In, class Out, class BinaryOp = std::plus<>,
+          class = internal::if_contiguous<In>,
+          class = internal::if_contiguous<Out>>
+void inclusive_scan(const In &in, Out &out, BinaryOp op = BinaryOp(),
+                    const options &opts = options()) {
+  if (out.size() < in.size()) {
+    throw std::length_error("output is shorter than input");
+  }
+  parallel::inclusive_scan(in.data(), in.data() + in.size(), out.data(), op,
+                           opts);
+}
+
+}  // namespace parallel
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_PARALLEL_H
@@ -0,0 +1,878 @@
+#ifndef S21_CONTAINERS_SRC_S21_RADIX_MAP_H
+#define S21_CONTAINERS_SRC_S21_RADIX_MAP_H
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+// Maps a key to the byte string radix_map indexes it by. Byte strings must
+// compare like the keys and no key's string may be a prefix of another's:
+// integers are stored big-endian with the sign bit flipped, strings get a
+// terminating zero byte and so must not contain '\0' themselves.
+template <class K, class = void>
+struct radix_key_traits;
+
+template <class K>
+struct radix_key_traits<
+    K, std::enable_if_t<std::is_integral_v<K> && !std::is_same_v<K, bool>>> {
+  static std::size_t size(const K &) noexcept { return sizeof(K); }
+
+  static unsigned char byte(const K &key, std::size_t i) noexcept {
+    using U = std::make_unsigned_t<K>;
+    U bits = static_cast<U>(key);
+    if constexpr (std::is_signed_v<K>) bits ^= U(1) << (sizeof(K) * 8 - 1);
+    return static_cast<unsigned char>(bits >> (8 * (sizeof(K) - 1 - i)));
+  }
+};
+
+template <>
+struct radix_key_traits<std::string> {
+  static std::size_t size(const std::string &key) noexcept {
+    return key.size() + 1;
+  }
+
+  static unsigned char byte(const std::string &key, std::size_t i) noexcept {
+    return i < key.size() ? static_cast<unsigned char>(key[i]) : 0;
+  }
+};
+
+struct RadixHeader {
+  std::uint8_t type;
+};
+
+struct RadixLink {
+  RadixLink *prev;
+  RadixLink *next;
+};
+
+// Leaves are also chained in key order, so iteration never goes back into
+// the inner nodes.
+template <class K, class T>
+struct RadixLeaf : RadixHeader, RadixLink {
+  RadixLeaf(const K &k, const T &v)
+      : RadixHeader{0}, RadixLink{nullptr, nullptr}, key(k), value(v) {}
+
+  K key;
+  T value;
+};
+
+namespace {
+template <class K, class T>
+class RadixMapIterator {
+ public:
+  using key_type = K;
+  using value_type = T;
+  using leaf_type = RadixLeaf<key_type, value_type>;
+  using reference = value_type &;
+  using pointer = value_type *;
+
+  RadixMapIterator() : link_(nullptr) {}
+
+  explicit RadixMapIterator(RadixLink *link) : link_(link) {}
+
+  bool operator==(const RadixMapIterator &other) const {
+    return link_ == other.link_;
+  }
+
+  bool operator!=(const RadixMapIterator &other) const {
+    return link_ != other.link_;
+  }
+
+  reference operator*() const { return leaf()->value; }
+
+  pointer operator->() const { return &leaf()->value; }
+
+  RadixMapIterator &operator++() {
+    link_ = link_->next;
+    return *this;
+  }
+
+  RadixMapIterator &operator--() {
+    link_ = link_->prev;
+    return *this;
+  }
+
+  RadixMapIterator operator++(int) {
+    RadixMapIterator it = *this;
+    ++(*this);
+    return it;
+  }
+
+  RadixMapIterator operator--(int) {
+    RadixMapIterator it = *this;
+    --(*this);
+    return it;
+  }
+
+  const key_type &get_key() const { return leaf()->key; }
+
+  RadixLink *get_pointer() const { return link_; }
+
+ private:
+  leaf_type *leaf() const { return static_cast<leaf_type *>(link_); }
+
+  RadixLink *link_;
+};
+}  // namespace
+
+// Adaptive radix tree (ART): keys are split into bytes and every inner node
+// branches on one byte, growing from 4 to 16, 48 and 256 children as needed
+// so sparse levels stay small. Chains of single-child nodes are collapsed
+// into a prefix stored in the node below (the first kMaxPrefix bytes
+// inline, the rest read from a leaf when needed). A lookup costs at most
+// one step per key byte instead of O(log n) full key comparisons.
+template <class K, class T, class Traits = radix_key_traits<K>>
+class radix_map {
+ public:
+  using key_type = K;
+  using value_type = T;
+  using size_type = std::size_t;
+  using iterator = RadixMapIterator<key_type, value_type>;
+  using const_iterator = iterator;
+
+  radix_map() : root_(nullptr), size_(0) { head_.prev = head_.next = &head_; }
+
+  radix_map(std::initializer_list<std::pair<const key_type, value_type>> items)
+      : radix_map() {
+    for (auto it = items.begin(); it != items.end(); ++it) {
+      insert(it->first, it->second);
+    }
+  }
+
+  radix_map(const radix_map &other) : radix_map() { *this = other; }
+
+  radix_map(radix_map &&other) : radix_map() { swap(other); }
+
+  ~radix_map() { clear(); }
+
+  radix_map &operator=(const radix_map &other) {
+    if (this != &other) {
+      clear();
+      for (auto it = other.begin(); it != other.end(); ++it) {
+        insert(it.get_key(), *it);
+      }
+    }
+    return *this;
+  }
+
+  radix_map &operator=(radix_map &&other) {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  iterator begin() const noexcept { return iterator(head_.next); }
+
+  iterator end() const noexcept { return iterator(end_link()); }
+
+  bool empty() const noexcept { return !size_; }
+
+  size_type size() const noexcept { return size_; }
+
+  void clear() noexcept {
+    destroy(root_);
+    root_ = nullptr;
+    size_ = 0;
+    head_.prev = head_.next = &head_;
+  }
+
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const value_type &value) {
+    bool inserted = false;
+    leaf_type *leaf = insert_at(root_, key, 0, value, false, inserted);
+    return std::make_pair(iterator(leaf), inserted);
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const value_type &value) {
+    bool inserted = false;
+    leaf_type *leaf = insert_at(root_, key, 0, value, true, inserted);
+    return std::make_pair(iterator(leaf), inserted);
+  }
+
+  size_type erase(const key_type &key) { return erase_at(root_, key, 0); }
+
+  iterator erase(const_iterator pos) {
+    iterator next = pos;
+    ++next;
+    erase(pos.get_key());
+    return next;
+  }
+
+  void swap(radix_map &other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(size_, other.size_);
+    std::swap(head_, other.head_);
+    relink_head();
+    other.relink_head();
+  }
+
+  value_type &at(const key_type &key) {
+    leaf_type *leaf = find_leaf(key);
+    if (leaf == nullptr) {
+      throw std::out_of_range("Key doesn't exist");
+    }
+    return leaf->value;
+  }
+
+  const value_type &at(const key_type &key) const {
+    return const_cast<radix_map *>(this)->at(key);
+  }
+
+  value_type &operator[](const key_type &key) {
+    return *insert(key, value_type()).first;
+  }
+
+  iterator find(const key_type &key) const {
+    leaf_type *leaf = find_leaf(key);
+    return leaf ? iterator(leaf) : end();
+  }
+
+  bool contains(const key_type &key) const {
+    return find_leaf(key) != nullptr;
+  }
+
+  iterator lower_bound(const key_type &key) const {
+    leaf_type *leaf = lower_leaf(root_, key, 0);
+    return leaf ? iterator(leaf) : end();
+  }
+
+  iterator upper_bound(const key_type &key) const {
+    iterator it = lower_bound(key);
+    if (it != end() && it.get_key() == key) ++it;
+    return it;
+  }
+
+  // Calls fn(key, value) for every element in key order. If fn returns
+  // bool, false stops the walk.
+  template <class Fn>
+  void for_each(Fn fn) const {
+    for (RadixLink *link = head_.next; link != end_link(); link = link->next) {
+      leaf_type *leaf = static_cast<leaf_type *>(link);
+      if constexpr (std::is_same_v<decltype(fn(leaf->key, leaf->value)),
+                                   bool>) {
+        if (!fn(leaf->key, leaf->value)) break;
+      } else {
+        fn(leaf->key, leaf->value);
+      }
+    }
+  }
+
+ private:
+  using leaf_type = RadixLeaf<key_type, value_type>;
+
+  enum : std::uint8_t { kLeaf, kNode4, kNode16, kNode48, kNode256 };
+
+  static constexpr size_type kMaxPrefix = 10;
+
+  struct Inner : RadixHeader {
+    explicit Inner(std::uint8_t t)
+        : RadixHeader{t}, count(0), prefix_len(0), prefix() {}
+
+    std::uint16_t count;
+    std::uint32_t prefix_len;
+    unsigned char prefix[kMaxPrefix];
+  };
+
+  // Node4 and Node16 keep their key bytes sorted; Node48 maps a byte to
+  // 1 + the slot of its child; Node256 is indexed by the byte directly.
+  struct Node4 : Inner {
+    Node4() : Inner(kNode4), keys(), children() {}
+    unsigned char keys[4];
+    RadixHeader *children[4];
+  };
+
+  struct Node16 : Inner {
+    Node16() : Inner(kNode16), keys(), children() {}
+    unsigned char keys[16];
+    RadixHeader *children[16];
+  };
+
+  struct Node48 : Inner {
+    Node48() : Inner(kNode48), index(), children() {}
+    unsigned char index[256];
+    RadixHeader *children[48];
+  };
+
+  struct Node256 : Inner {
+    Node256() : Inner(kNode256), children() {}
+    RadixHeader *children[256];
+  };
+
+  static unsigned char byte(const key_type &key, size_type i) {
+    return Traits::byte(key, i);
+  }
+
+  static bool is_leaf(const RadixHeader *node) { return node->type == kLeaf; }
+
+  static leaf_type *as_leaf(RadixHeader *node) {
+    return static_cast<leaf_type *>(node);
+  }
+
+  static Inner *as_inner(RadixHeader *node) {
+    return static_cast<Inner *>(node);
+  }
+
+  // -1, 0 or 1 as the byte string of a is below, equal to or above b's.
+  static int compare(const key_type &a, const key_type &b) {
+    size_type n = Traits::size(a);
+    size_type m = Traits::size(b);
+    for (size_type i = 0; i < n && i < m; i++) {
+      unsigned char x = byte(a, i), y = byte(b, i);
+      if (x != y) return x < y ? -1 : 1;
+    }
+    return n == m ? 0 : (n < m ? -1 : 1);
+  }
+
+  RadixLink *end_link() const noexcept {
+    return const_cast<RadixLink *>(&head_);
+  }
+
+  void relink_head() noexcept {
+    if (size_ == 0) {
+      head_.prev = head_.next = &head_;
+    } else {
+      head_.next->prev = &head_;
+      head_.prev->next = &head_;
+    }
+  }
+
+  static RadixHeader **find_child(Inner *node, unsigned char b) {
+    switch (node->type) {
+      case kNode4: {
+        Node4 *n = static_cast<Node4 *>(node);
+        for (int i = 0; i < n->count; i++) {
+          if (n->keys[i] == b) return &n->children[i];
+        }
+        break;
+      }
+      case kNode16: {
+        Node16 *n = static_cast<Node16 *>(node);
+#if defined(__SSE2__)
+        // Compares the byte with all 16 keys at once.
+        __m128i cmp = _mm_cmpeq_epi8(
+            _mm_set1_epi8(static_cast<char>(b)),
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(n->keys)));
+        int mask = _mm_movemask_epi8(cmp) & ((1 << n->count) - 1);
+        if (mask) return &n->children[__builtin_ctz(mask)];
+#else
+        for (int i = 0; i < n->count; i++) {
+          if (n->keys[i] == b) return &n->children[i];
+        }
+#endif
+        break;
+      }
+      case kNode48: {
+        Node48 *n = static_cast<Node48 *>(node);
+        if (n->index[b]) return &n->children[n->index[b] - 1];
+        break;
+      }
+      default: {
+        Node256 *n = static_cast<Node256 *>(node);
+        if (n->children[b]) return &n->children[b];
+      }
+    }
+    return nullptr;
+  }
+
+  // Child on the smallest byte above b (-1 for the first child), or
+  // nullptr.
+  static RadixHeader *child_after(Inner *node, int b) {
+    switch (node->type) {
+      case kNode4: {
+        Node4 *n = static_cast<Node4 *>(node);
+        for (int i = 0; i < n->count; i++) {
+          if (n->keys[i] > b) return n->children[i];
+        }
+        break;
+      }
+      case kNode16: {
+        Node16 *n = static_cast<Node16 *>(node);
+        for (int i = 0; i < n->count; i++) {
+          if (n->keys[i] > b) return n->children[i];
+        }
+        break;
+      }
+      case kNode48: {
+        Node48 *n = static_cast<Node48 *>(node);
+        for (int i = b + 1; i < 256; i++) {
+          if (n->index[i]) return n->children[n->index[i] - 1];
+        }
+        break;
+      }
+      default: {
+        Node256 *n = static_cast<Node256 *>(node);
+        for (int i = b + 1; i < 256; i++) {
+          if (n->children[i]) return n->children[i];
+        }
+      }
+    }
+    return nullptr;
+  }
+
+  // Child on the largest byte below b (256 for the last child), or nullptr.
+  static RadixHeader *child_before(Inner *node, int b) {
+    switch (node->type) {
+      case kNode4: {
+        Node4 *n = static_cast<Node4 *>(node);
+        for (int i = n->count - 1; i >= 0; i--) {
+          if (n->keys[i] < b) return n->children[i];
+        }
+        break;
+      }
+      case kNode16: {
+        Node16 *n = static_cast<Node16 *>(node);
+        for (int i = n->count - 1; i >= 0; i--) {
+          if (n->keys[i] < b) return n->children[i];
+        }
+        break;
+      }
+      case kNode48: {
+        Node48 *n = static_cast<Node48 *>(node);
+        for (int i = b - 1; i >= 0; i--) {
+          if (n->index[i]) return n->children[n->index[i] - 1];
+        }
+        break;
+      }
+      default: {
+        Node256 *n = static_cast<Node256 *>(node);
+        for (int i = b - 1; i >= 0; i--) {
+          if (n->children[i]) return n->children[i];
+        }
+      }
+    }
+    return nullptr;
+  }
+
+  static leaf_type *min_leaf(RadixHeader *node) {
+    while (!is_leaf(node)) node = child_after(as_inner(node), -1);
+    return as_leaf(node);
+  }
+
+  static leaf_type *max_leaf(RadixHeader *node) {
+    while (!is_leaf(node)) node = child_before(as_inner(node), 256);
+    return as_leaf(node);
+  }
+
+  static void copy_header(Inner *to, const Inner *from) {
+    to->count = from->count;
+    to->prefix_len = from->prefix_len;
+    std::memcpy(to->prefix, from->prefix, kMaxPrefix);
+  }
+
+  // Inserts child in sorted position into a Node4 or Node16 with room.
+  template <class Node>
+  static void insert_sorted(Node *n, unsigned char b, RadixHeader *child) {
+    int i = n->count;
+    for (; i > 0 && n->keys[i - 1] > b; i--) {
+      n->keys[i] = n->keys[i - 1];
+      n->children[i] = n->children[i - 1];
+    }
+    n->keys[i] = b;
+    n->children[i] = child;
+    n->count++;
+  }
+
+  // Adds child under byte b, replacing the node in ref by a larger one if it
+  // is full.
+  static void add_child(RadixHeader *&ref, Inner *node, unsigned char b,
+                        RadixHeader *child) {
+    switch (node->type) {
+      case kNode4: {
+        Node4 *n = static_cast<Node4 *>(node);
+        if (n->count < 4) return insert_sorted(n, b, child);
+        Node16 *grown = new Node16();
+        copy_header(grown, n);
+        std::memcpy(grown->keys, n->keys, sizeof(n->keys));
+        std::memcpy(grown->children, n->children, sizeof(n->children));
+        delete n;
+        ref = grown;
+        return insert_sorted(grown, b, child);
+      }
+      case kNode16: {
+        Node16 *n = static_cast<Node16 *>(node);
+        if (n->count < 16) return insert_sorted(n, b, child);
+        Node48 *grown = new Node48();
+        copy_header(grown, n);
+        for (int i = 0; i < n->count; i++) {
+          grown->index[n->keys[i]] = static_cast<unsigned char>(i + 1);
+          grown->children[i] = n->children[i];
+        }
+        delete n;
+        ref = grown;
+        return add_child(ref, grown, b, child);
+      }
+      case kNode48: {
+        Node48 *n = static_cast<Node48 *>(node);
+        if (n->count < 48) {
+          int slot = 0;
+          while (n->children[slot] != nullptr) slot++;
+          n->children[slot] = child;
+          n->index[b] = static_cast<unsigned char>(slot + 1);
+          n->count++;
+          return;
+        }
+        Node256 *grown = new Node256();
+        copy_header(grown, n);
+        for (int i = 0; i < 256; i++) {
+          if (n->index[i]) grown->children[i] = n->children[n->index[i] - 1];
+        }
+        delete n;
+        ref = grown;
+        return add_child(ref, grown, b, child);
+      }
+      default: {
+        Node256 *n = static_cast<Node256 *>(node);
+        n->children[b] = child;
+        n->count++;
+      }
+    }
+  }
+
+  template <class Node>
+  static void remove_sorted(Node *n, RadixHeader **slot) {
+    int i = static_cast<int>(slot - n->children);
+    for (; i + 1 < n->count; i++) {
+      n->keys[i] = n->keys[i + 1];
+      n->children[i] = n->children[i + 1];
+    }
+    n->children[i] = nullptr;
+    n->count--;
+  }
+
+  // Removes the child in slot (under byte b) and shrinks the node in ref
+  // once it is sparse enough; a Node4 left with one child is merged into it.
+  static void remove_child(RadixHeader *&ref, Inner *node, unsigned char b,
+                           RadixHeader **slot) {
+    switch (node->type) {
+      case kNode4: {
+        Node4 *n = static_cast<Node4 *>(node);
+        remove_sorted(n, slot);
+        if (n->count == 1) collapse(ref, n);
+        return;
+      }
+      case kNode16: {
+        Node16 *n = static_cast<Node16 *>(node);
+        remove_sorted(n, slot);
+        if (n->count > 3) return;
+        Node4 *shrunk = new Node4();
+        copy_header(shrunk, n);
+        std::memcpy(shrunk->keys, n->keys, 3);
+        std::memcpy(shrunk->children, n->children, 3 * sizeof(RadixHeader *));
+        delete n;
+        ref = shrunk;
+        return;
+      }
+      case kNode48: {
+        Node48 *n = static_cast<Node48 *>(node);
+        n->children[n->index[b] - 1] = nullptr;
+        n->index[b] = 0;
+        if (--n->count > 12) return;
+        Node16 *shrunk = new Node16();
+        copy_header(shrunk, n);
+        int child = 0;
+        for (int i = 0; i < 256; i++) {
+          if (!n->index[i]) continue;
+          shrunk->keys[child] = static_cast<unsigned char>(i);
+          shrunk->children[child++] = n->children[n->index[i] - 1];
+        }
+        delete n;
+        ref = shrunk;
+        return;
+      }
+      default: {
+        Node256 *n = static_cast<Node256 *>(node);
+        n->children[b] = nullptr;
+        if (--n->count > 37) return;
+        Node48 *shrunk = new Node48();
+        copy_header(shrunk, n);
+        int child = 0;
+        for (int i = 0; i < 256; i++) {
+          if (!n->children[i]) continue;
+          shrunk->index[i] = static_cast<unsigned char>(child + 1);
+          shrunk->children[child++] = n->children[i];
+        }
+        delete n;
+        ref = shrunk;
+      }
+    }
+  }
+
+  // Replaces a Node4 with one child by that child, moving the node's prefix
+  // and branch byte in front of the child's prefix.
+  static void collapse(RadixHeader *&ref, Node4 *n) {
+    RadixHeader *child = n->children[0];
+    if (!is_leaf(child)) {
+      Inner *c = as_inner(child);
+      size_type len = n->prefix_len;
+      if (len < kMaxPrefix) n->prefix[len++] = n->keys[0];
+      if (len < kMaxPrefix) {
+        size_type sub = c->prefix_len < kMaxPrefix - len ? c->prefix_len
+                                                         : kMaxPrefix - len;
+        std::memcpy(n->prefix + len, c->prefix, sub);
+        len += sub;
+      }
+      std::memcpy(c->prefix, n->prefix, len < kMaxPrefix ? len : kMaxPrefix);
+      c->prefix_len += n->prefix_len + 1;
+    }
+    delete n;
+    ref = child;
+  }
+
+  // Length of the common part of the node's prefix and key from depth.
+  static size_type prefix_mismatch(Inner *n, const key_type &key,
+                                   size_type depth) {
+    size_type key_size = Traits::size(key);
+    size_type limit = n->prefix_len;
+    if (limit > key_size - depth) limit = key_size - depth;
+    size_type i = 0;
+    for (; i < limit && i < kMaxPrefix; i++) {
+      if (n->prefix[i] != byte(key, depth + i)) return i;
+    }
+    if (i < limit) {
+      leaf_type *leaf = min_leaf(n);
+      for (; i < limit; i++) {
+        if (byte(leaf->key, depth + i) != byte(key, depth + i)) return i;
+      }
+    }
+    return i;
+  }
+
+  leaf_type *make_leaf(const key_type &key, const value_type &value) {
+    size_++;
+    return new leaf_type(key, value);
+  }
+
+  static void link_before(RadixLink *pos, RadixLink *link) {
+    link->prev = pos->prev;
+    link->next = pos;
+    pos->prev->next = link;
+    pos->prev = link;
+  }
+
+  // Chains a leaf just added to node under byte b next to its neighbours in
+  // the node.
+  static void link_leaf(Inner *node, unsigned char b, leaf_type *leaf) {
+    RadixHeader *next = child_after(node, b);
+    if (next != nullptr)
+      link_before(min_leaf(next), leaf);
+    else
+      link_before(max_leaf(child_before(node, b))->next, leaf);
+  }
+
+  leaf_type *insert_at(RadixHeader *&ref, const key_type &key,
+                       size_type depth, const value_type &value, bool assign,
+                       bool &inserted) {
+    if (ref == nullptr) {
+      leaf_type *leaf = make_leaf(key, value);
+      link_before(&head_, leaf);
+      ref = leaf;
+      inserted = true;
+      return leaf;
+    }
+    if (is_leaf(ref)) {
+      leaf_type *leaf = as_leaf(ref);
+      if (leaf->key == key) {
+        if (assign) leaf->value = value;
+        return leaf;
+      }
+      size_type last = Traits::size(key);
+      if (last < Traits::size(leaf->key)) last = Traits::size(leaf->key);
+      size_type lcp = depth;
+      while (lcp + 1 < last && byte(leaf->key, lcp) == byte(key, lcp)) lcp++;
+      lcp -= depth;
+      Node4 *split = new Node4();
+      split->prefix_len = static_cast<std::uint32_t>(lcp);
+      for (size_type i = 0; i < lcp && i < kMaxPrefix; i++) {
+        split->prefix[i] = byte(key, depth + i);
+      }
+      leaf_type *added = make_leaf(key, value);
+      insert_sorted(split, byte(leaf->key, depth + lcp), leaf);
+      insert_sorted(split, byte(key, depth + lcp), added);
+      ref = split;
+      link_leaf(split, byte(key, depth + lcp), added);
+      inserted = true;
+      return added;
+    }
+    Inner *node = as_inner(ref);
+    if (node->prefix_len) {
+      size_type mismatch = prefix_mismatch(node, key, depth);
+      if (mismatch < node->prefix_len) {
+        return split_prefix(ref, node, key, depth, mismatch, value, inserted);
+      }
+      depth += node->prefix_len;
+    }
+    unsigned char b = byte(key, depth);
+    RadixHeader **child = find_child(node, b);
+    if (child != nullptr) {
+      return insert_at(*child, key, depth + 1, value, assign, inserted);
+    }
+    leaf_type *added = make_leaf(key, value);
+    add_child(ref, node, b, added);
+    link_leaf(as_inner(ref), b, added);
+    inserted = true;
+    return added;
+  }
+
+  // Key leaves the prefix of node after mismatch bytes: puts a Node4 above
+  // node holding the common part, with node and the new leaf as children.
+  leaf_type *split_prefix(RadixHeader *&ref, Inner *node, const key_type &key,
+                          size_type depth, size_type mismatch,
+                          const value_type &value, bool &inserted) {
+    Node4 *split = new Node4();
+    split->prefix_len = static_cast<std::uint32_t>(mismatch);
+    std::memcpy(split->prefix, node->prefix,
+                mismatch < kMaxPrefix ? mismatch : kMaxPrefix);
+    unsigned char node_byte;
+    if (node->prefix_len <= kMaxPrefix) {
+      node_byte = node->prefix[mismatch];
+      node->prefix_len -= static_cast<std::uint32_t>(mismatch + 1);
+      std::memmove(node->prefix, node->prefix + mismatch + 1,
+                   node->prefix_len);
+    } else {
+      leaf_type *leaf = min_leaf(node);
+      node_byte = byte(leaf->key, depth + mismatch);
+      node->prefix_len -= static_cast<std::uint32_t>(mismatch + 1);
+      for (size_type i = 0; i < node->prefix_len && i < kMaxPrefix; i++) {
+        node->prefix[i] = byte(leaf->key, depth + mismatch + 1 + i);
+      }
+    }
+    leaf_type *added = make_leaf(key, value);
+    unsigned char b = byte(key, depth + mismatch);
+    insert_sorted(split, node_byte, node);
+    insert_sorted(split, b, added);
+    ref = split;
+    link_leaf(split, b, added);
+    inserted = true;
+    return added;
+  }
+
+  size_type erase_at(RadixHeader *&ref, const key_type &key, size_type depth) {
+    if (ref == nullptr) return 0;
+    if (is_leaf(ref)) {
+      if (!(as_leaf(ref)->key == key)) return 0;
+      drop_leaf(as_leaf(ref));
+      ref = nullptr;
+      return 1;
+    }
+    Inner *node = as_inner(ref);
+    if (node->prefix_len) {
+      if (prefix_mismatch(node, key, depth) < node->prefix_len) return 0;
+      depth += node->prefix_len;
+    }
+    unsigned char b = byte(key, depth);
+    RadixHeader **child = find_child(node, b);
+    if (child == nullptr) return 0;
+    if (!is_leaf(*child)) return erase_at(*child, key, depth + 1);
+    leaf_type *leaf = as_leaf(*child);
+    if (!(leaf->key == key)) return 0;
+    remove_child(ref, node, b, child);
+    drop_leaf(leaf);
+    return 1;
+  }
+
+  void drop_leaf(leaf_type *leaf) {
+    leaf->prev->next = leaf->next;
+    leaf->next->prev = leaf->prev;
+    delete leaf;
+    size_--;
+  }
+
+  // Compares only the inline prefix bytes and checks the whole key at the
+  // leaf, so long prefixes cost no extra reads.
+  leaf_type *find_leaf(const key_type &key) const {
+    RadixHeader *node = root_;
+    size_type depth = 0;
+    while (node != nullptr) {
+      if (is_leaf(node)) {
+        return as_leaf(node)->key == key ? as_leaf(node) : nullptr;
+      }
+      Inner *n = as_inner(node);
+      for (size_type i = 0; i < n->prefix_len && i < kMaxPrefix; i++) {
+        if (n->prefix[i] != byte(key, depth + i)) return nullptr;
+      }
+      depth += n->prefix_len;
+      RadixHeader **child = find_child(n, byte(key, depth++));
+      node = child ? *child : nullptr;
+    }
+    return nullptr;
+  }
+
+  // First leaf of the subtree at node not below key, or nullptr.
+  static leaf_type *lower_leaf(RadixHeader *node, const key_type &key,
+                               size_type depth) {
+    if (node == nullptr) return nullptr;
+    if (is_leaf(node)) {
+      return compare(as_leaf(node)->key, key) >= 0 ? as_leaf(node) : nullptr;
+    }
+    Inner *n = as_inner(node);
+    leaf_type *first = nullptr;
+    for (size_type i = 0; i < n->prefix_len; i++) {
+      unsigned char p;
+      if (i < kMaxPrefix) {
+        p = n->prefix[i];
+      } else {
+        if (first == nullptr) first = min_leaf(n);
+        p = byte(first->key, depth + i);
+      }
+      unsigned char k = byte(key, depth + i);
+      if (k < p) return min_leaf(n);
+      if (k > p) return nullptr;
+    }
+    depth += n->prefix_len;
+    unsigned char b = byte(key, depth);
+    RadixHeader **child = find_child(n, b);
+    if (child != nullptr) {
+      leaf_type *res = lower_leaf(*child, key, depth + 1);
+      if (res != nullptr) return res;
+    }
+    RadixHeader *next = child_after(n, b);
+    return next ? min_leaf(next) : nullptr;
+  }
+
+  static void destroy(RadixHeader *node) noexcept {
+    if (node == nullptr) return;
+    switch (node->type) {
+      case kLeaf:
+        delete as_leaf(node);
+        break;
+      case kNode4:
+        destroy_children(static_cast<Node4 *>(node), 4);
+        break;
+      case kNode16:
+        destroy_children(static_cast<Node16 *>(node), 16);
+        break;
+      case kNode48:
+        destroy_children(static_cast<Node48 *>(node), 48);
+        break;
+      default:
+        destroy_children(static_cast<Node256 *>(node), 256);
+    }
+  }
+
+  // Unused slots of every node type hold nullptr.
+  template <class Node>
+  static void destroy_children(Node *n, int slots) noexcept {
+    for (int i = 0; i < slots; i++) destroy(n->children[i]);
+    delete n;
+  }
+
+  RadixHeader *root_;
+  // Sentinel of the circular leaf chain: head_.next is the first leaf,
+  // head_.prev the last, and &head_ serves as end().
+  RadixLink head_;
+  size_type size_;
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_RADIX_MAP_H
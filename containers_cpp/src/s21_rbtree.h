@@ -1,15 +1,26 @@
 #ifndef S21_CONTAINERS_SRC_S21_RBTREE_H_
 #define S21_CONTAINERS_SRC_S21_RBTREE_H_
 
-namespace s21 {
-enum Color { BLACK, RED };
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include "s21_allocator.h"
+#include "s21_bloom_filter.h"
+#include "s21_tree_balance.h"
 
+namespace s21 {
 template <class K, class T>
 struct Node {
   using key_type = K;
   using value_type = T;
 
-  Node() : color(RED), parent(nullptr), left(nullptr), right(nullptr) {}
+  Node()
+      : color(RED),
+        parent(nullptr),
+        left(nullptr),
+        right(nullptr) {}
 
   Node(const Node &another)
       : key(another.key),
@@ -19,10 +30,13 @@ struct Node {
         left(another.left),
         right(another.right) {}
 
-  Node(key_type k, value_type v) {
-    key = k;
-    value = v;
-  }
+  Node(const key_type &k, const value_type &v)
+      : key(k),
+        value(v),
+        color(RED),
+        parent(nullptr),
+        left(nullptr),
+        right(nullptr) {}
 
   ~Node() {}
 
@@ -49,6 +63,24 @@ struct Node {
   Node *right;
 };
 
+// Node of a tree balanced by avl_balance: the height of its subtree.
+template <class K, class T>
+struct AvlNode : Node<K, T> {
+  using Node<K, T>::Node;
+
+  int height = 1;
+};
+
+// Node of a tree declared with the merkle<> policy: the sum of the entry
+// hashes of its subtree, kept while the Merkle augmentation is enabled.
+// Base is the node the balancing policy needs.
+template <class Base>
+struct HashedNode : Base {
+  using Base::Base;
+
+  std::size_t hash = 0;
+};
+
 namespace {
 template <class K, class T>
 class TreeConstIterator {
@@ -97,107 +129,31 @@ class TreeConstIterator {
   reference operator*() { return ptr_->value; }
 
   TreeConstIterator &operator++() {
-    TreeConstIterator last = end();
-    last--;
-    if (ptr_ && ptr_ != last.ptr_) {
-      if (ptr_->right) {
-        if (ptr_->right->left) {
-          ptr_ = ptr_->right;
-          while (ptr_->left) {
-            ptr_ = ptr_->left;
-          }
-        } else {
-          ptr_ = ptr_->right;
-        }
-      } else if (ptr_->parent) {
-        while (ptr_ == ptr_->parent->right && ptr_->parent->parent) {
-          ptr_ = ptr_->parent;
-        }
-        ptr_ = ptr_->parent;
-      }
-    } else {
-      ptr_ = nullptr;
-    }
+    increment();
     return *this;
   }
 
   TreeConstIterator &operator--() {
-    if (ptr_ && ptr_ != begin().ptr_) {
-      if (ptr_->left) {
-        if (ptr_->left->right) {
-          ptr_ = ptr_->left;
-          while (ptr_->right) {
-            ptr_ = ptr_->right;
-          }
-        } else {
-          ptr_ = ptr_->left;
-        }
-      } else if (ptr_->parent) {
-        while (ptr_ == ptr_->parent->left && ptr_->parent->parent) {
-          ptr_ = ptr_->parent;
-        }
-        ptr_ = ptr_->parent;
-      }
-    } else if (!ptr_) {
-      ptr_ = get_last();
-    }
+    decrement();
     return *this;
   }
 
   TreeConstIterator operator++(int) {
     TreeConstIterator it = *this;
-    TreeConstIterator last = end();
-    last--;
-    if (ptr_ && ptr_ != last.ptr_) {
-      if (ptr_->right) {
-        if (ptr_->right->left) {
-          ptr_ = ptr_->right;
-          while (ptr_->left) {
-            ptr_ = ptr_->left;
-          }
-        } else {
-          ptr_ = ptr_->right;
-        }
-      } else if (ptr_->parent) {
-        while (ptr_ == ptr_->parent->right && ptr_->parent->parent) {
-          ptr_ = ptr_->parent;
-        }
-        ptr_ = ptr_->parent;
-      }
-    } else {
-      ptr_ = nullptr;
-    }
+    increment();
     return it;
   }
 
   TreeConstIterator operator--(int) {
     TreeConstIterator it = *this;
-    if (ptr_ && ptr_ != begin().ptr_) {
-      if (ptr_->left) {
-        if (ptr_->left->right) {
-          ptr_ = ptr_->left;
-          while (ptr_->right) {
-            ptr_ = ptr_->right;
-          }
-        } else {
-          ptr_ = ptr_->left;
-        }
-      } else if (ptr_->parent) {
-        while (ptr_ == ptr_->parent->left && ptr_->parent->parent) {
-          ptr_ = ptr_->parent;
-        }
-        ptr_ = ptr_->parent;
-      }
-    } else if (!ptr_) {
-      ptr_ = get_last();
-    }
+    decrement();
     return it;
   }
 
   TreeConstIterator begin() {
     TreeConstIterator it(*this);
-    it.ptr_ = it.root_;
-    while (it.ptr_->left) {
+    it.ptr_ = it.get_root();
+    while (it.ptr_ && it.ptr_->left) {
       it.ptr_ = it.ptr_->left;
     }
     return it;
@@ -214,14 +170,59 @@ class TreeConstIterator {
   node_type *get_pointer() { return ptr_; }
 
   node_type *get_last() {
-    ptr_ = root_;
-    while (ptr_->right) {
+    ptr_ = get_root();
+    while (ptr_ && ptr_->right) {
       ptr_ = ptr_->right;
     }
     return ptr_;
   }
 
  protected:
+  // The root seen at construction may have moved down since (a self-adjusting
+  // tree restructures itself on lookups), so climb to the current one.
+  node_type *get_root() {
+    while (root_ && root_->parent) {
+      root_ = root_->parent;
+    }
+    return root_;
+  }
+
+  void increment() {
+    if (!ptr_) return;
+    if (ptr_->right) {
+      ptr_ = ptr_->right;
+      while (ptr_->left) {
+        ptr_ = ptr_->left;
+      }
+    } else {
+      node_type *parent = ptr_->parent;
+      while (parent && ptr_ == parent->right) {
+        ptr_ = parent;
+        parent = parent->parent;
+      }
+      ptr_ = parent;
+    }
+  }
+
+  void decrement() {
+    if (!ptr_) {
+      ptr_ = get_last();
+    } else if (ptr_->left) {
+      ptr_ = ptr_->left;
+      while (ptr_->right) {
+        ptr_ = ptr_->right;
+      }
+    } else {
+      node_type *child = ptr_;
+      node_type *parent = ptr_->parent;
+      while (parent && child == parent->left) {
+        child = parent;
+        parent = parent->parent;
+      }
+      if (parent) ptr_ = parent;
+    }
+  }
+
   node_type *ptr_;
   node_type *root_;
 };
@@ -234,53 +235,146 @@ class TreeIterator : public TreeConstIterator<K, T> {
   using node_type = Node<key_type, value_type>;
 
  public:
+  TreeIterator() : base() {}
+
   TreeIterator(const base &other) : base(other) {}
 };
 }  // namespace
 
-template <class K, class T>
-class tree {
+// Whether std::hash can hash T. The Bloom filter of tree needs it for the
+// keys, the Merkle augmentation for both the keys and the values; trees that
+// use neither take any key type.
+template <class T, class = void>
+struct is_hashable : std::false_type {};
+
+template <class T>
+struct is_hashable<
+    T, std::void_t<decltype(std::hash<T>()(std::declval<const T &>()))>>
+    : std::true_type {};
+
+// What a tree allocates for each node: an AvlNode for avl_balance, a plain
+// Node otherwise, wrapped in a HashedNode under the merkle<> policy.
+template <class K, class T, class Balance>
+using balanced_node_t =
+    std::conditional_t<std::is_same_v<Balance, avl_balance>, AvlNode<K, T>,
+                       Node<K, T>>;
+
+template <class K, class T, class Balance>
+using tree_node_t = std::conditional_t<
+    balance_traits<Balance>::is_merkle,
+    HashedNode<balanced_node_t<K, T, typename balance_traits<Balance>::policy>>,
+    balanced_node_t<K, T, Balance>>;
+
+// Nodes are allocated by Allocator rebound to tree_node_t. The allocator
+// type defaults to the one of a map over the same keys and values; only
+// its rebound copy is ever used.
+template <class K, class T, class Balance = rb_balance,
+          class Allocator = std::allocator<std::pair<const K, T>>>
+class tree
+    : private allocator_holder<typename std::allocator_traits<
+          Allocator>::template rebind_alloc<tree_node_t<K, T, Balance>>> {
+  using stored_node = tree_node_t<K, T, Balance>;
+  using node_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<stored_node>;
+  using policy = typename balance_traits<Balance>::policy;
+  static constexpr bool kMerkle = balance_traits<Balance>::is_merkle;
+  using base = allocator_holder<node_allocator>;
+  using typename base::alloc_traits;
+  using base::alloc;
+
  public:
   using key_type = K;
   using value_type = T;
   using size_type = std::size_t;
   using node_type = Node<key_type, value_type>;
-  using tree_type = tree<key_type, value_type>;
+  using tree_type = tree<key_type, value_type, Balance, Allocator>;
+  using balance_type = Balance;
+  using allocator_type = Allocator;
   using iterator = TreeIterator<key_type, value_type>;
   using const_iterator = TreeConstIterator<key_type, value_type>;
-
-  tree() : root_(nullptr), size_(0), is_multi_(false) {}
-
-  tree(bool is_multi) : root_(nullptr), size_(0), is_multi_(is_multi) {}
-
-  tree(const tree &other) {
+  using bloom_type = bloom_filter<key_type>;
+
+  tree()
+      : root_(nullptr),
+        size_(0),
+        is_multi_(false),
+        arena_(nullptr),
+        arena_size_(0),
+        bloom_(nullptr),
+        merkle_(false) {}
+
+  tree(bool is_multi)
+      : root_(nullptr),
+        size_(0),
+        is_multi_(is_multi),
+        arena_(nullptr),
+        arena_size_(0),
+        bloom_(nullptr),
+        merkle_(false) {}
+
+  explicit tree(const allocator_type &alloc, bool is_multi = false)
+      : base(node_allocator(alloc)),
+        root_(nullptr),
+        size_(0),
+        is_multi_(is_multi),
+        arena_(nullptr),
+        arena_size_(0),
+        bloom_(nullptr),
+        merkle_(false) {}
+
+  tree(const tree &other)
+      : base(alloc_traits::select_on_container_copy_construction(
+            other.alloc())),
+        arena_(nullptr),
+        arena_size_(0),
+        bloom_(copy_bloom(other.bloom_)),
+        merkle_(other.merkle_) {
     root_ = copy_node(other.root_);
     size_ = other.size_;
     is_multi_ = other.is_multi_;
   }
 
-  tree(tree &&other) {
-    root_ = copy_node(other.root_);
-    size_ = other.size_;
-    is_multi_ = other.is_multi_;
-    other.clear();
+  // Takes the nodes of other, compacted arena and filter included.
+  tree(tree &&other) noexcept
+      : base(std::move(other.alloc())),
+        root_(nullptr),
+        size_(0),
+        is_multi_(false),
+        arena_(nullptr),
+        arena_size_(0),
+        bloom_(nullptr),
+        merkle_(false) {
+    steal(other);
   }
 
   ~tree() noexcept {
-    if (root_ != nullptr) clear_node(root_);
+    release();
+    delete bloom_;
   }
 
   tree &operator=(const tree &other) {
-    root_ = copy_node(other.root_);
-    size_ = other.size_;
-    is_multi_ = other.is_multi_;
+    if (this != &other) {
+      release();
+      this->copy_alloc(other.alloc());
+      copy_from(other);
+    }
     return *this;
   }
 
+  // Takes the nodes of other unless the allocators differ and do not
+  // propagate, in which case they are copied and other is cleared.
   tree &operator=(tree &&other) {
-    root_ = copy_node(other.root_);
-    size_ = other.size_;
-    is_multi_ = other.is_multi_;
+    if (this != &other) {
+      release();
+      if (alloc_traits::propagate_on_container_move_assignment::value ||
+          this->same_alloc(other.alloc())) {
+        this->move_alloc(other.alloc());
+        steal(other);
+      } else {
+        copy_from(other);
+        other.clear();
+      }
+    }
     return *this;
   }
 
@@ -313,26 +407,30 @@ class tree {
   size_type size() const noexcept { return size_; }
 
   size_type max_size() const noexcept {
-    return std::numeric_limits<size_type>::max() /
-           sizeof(tree<key_type, value_type>);
+    return std::min<size_type>(
+        std::numeric_limits<size_type>::max() / sizeof(tree_type),
+        alloc_traits::max_size(alloc()));
+  }
+
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(alloc());
   }
 
   void clear() noexcept {
-    clear_node(root_);
-    root_ = nullptr;
-    size_ = 0;
+    release();
+    if (bloom_ != nullptr) bloom_->clear();
   }
 
   std::pair<iterator, bool> insert(const key_type &key,
                                    const value_type &value) {
-    node_type *node = new node_type;
-    node->key = key;
-    node->value = value;
+    node_type *node = create_node(key, value);
     if (root_ == nullptr) {
       root_ = node;
       node->color = BLACK;
+      if (merkle_) update_hashes_up(node);
       this->size_++;
-      return std::make_pair(find(key), true);
+      bloom_insert(key);
+      return std::make_pair(iterator(node), true);
     }
     node_type *curr = nullptr;
     auto *tmp = this->root_;
@@ -347,8 +445,8 @@ class tree {
           tmp = tmp->right;
           if (tmp) continue;
         } else {
-          delete node;
-          return std::make_pair(find(key), false);
+          destroy_node(node);
+          return std::make_pair(iterator(find_node(key)), false);
         }
       }
     }
@@ -357,17 +455,19 @@ class tree {
       curr->left = node;
     else
       curr->right = node;
-    update_tree_after_insert(curr, node);
+    if (merkle_) update_hashes_up(node);
+    policy::after_insert(*this, node);
     this->size_++;
-    return std::make_pair(find(key), true);
+    bloom_insert(key);
+    return std::make_pair(iterator(node), true);
   }
 
+  // Removes the node pos points to, not just some node with its key, and
+  // returns the element after it.
   iterator erase(const_iterator pos) {
     key_type key = pos.get_key();
     size_type c = count_same_key_before_pos(pos);
-    if (*pos) {
-      extract(key);
-    }
+    extract_node(pos.get_pointer());
     iterator it = lower_bound(key);
     for (size_type i = 0; i < c; i++) {
       it++;
@@ -379,14 +479,12 @@ class tree {
     if (first == cbegin() && last == cend()) {
       clear();
       return end();
+    } else if (last == cend()) {
+      while (first != cend()) first = erase(first);
+      return end();
     } else {
-      value_type val;
-      size_type c;
-      const_iterator const_it = last;
-      if (last != cend()) {
-        val = *last;
-        c = count_same_key_before_pos(last);
-      }
+      value_type val = *last;
+      size_type c = count_same_key_before_pos(last);
       while (*first != val) {
         first = erase(first);
         if (first == end()) {
@@ -411,14 +509,28 @@ class tree {
     return c;
   }
 
+  // The allocators are exchanged only if they propagate on swap; otherwise
+  // they must compare equal.
   void swap(tree &other) {
+    this->swap_alloc(other.alloc());
     std::swap(root_, other.root_);
     std::swap(size_, other.size_);
     std::swap(is_multi_, other.is_multi_);
+    std::swap(arena_, other.arena_);
+    std::swap(arena_size_, other.arena_size_);
+    std::swap(bloom_, other.bloom_);
+    std::swap(merkle_, other.merkle_);
   }
 
   node_type extract(const key_type &key) {
-    node_type *node = find(key).get_pointer();
+    return extract_node(find_node(key));
+  }
+
+  node_type extract(const_iterator pos) {
+    return extract_node(pos.get_pointer());
+  }
+
+  node_type extract_node(node_type *node) {
     node_type del_node;
     if (node != nullptr) {
       del_node.parent = node->parent;
@@ -426,8 +538,9 @@ class tree {
       del_node.right = node->right;
       del_node.key = node->key;
       del_node.value = node->value;
-      delete_node(node);
+      policy::erase(*this, node);
       this->size_--;
+      if (bloom_ != nullptr) bloom_->stats().erased_since_rebuild++;
     }
     return del_node;
   }
@@ -438,105 +551,507 @@ class tree {
     return search.get_pointer() ? 1 : 0;
   }
 
+  // Walks only the run of equal keys: O(log n + count).
   size_type count_multi(const key_type &key) const {
-    const_iterator it = cbegin();
-    size_t res = 0;
-    for (int i = 0; i < size_; i++) {
-      if (*it == key) res++;
-      if (i != size_ - 1) it++;
+    if (bloom_rejects(key)) return 0;
+    size_type res = 0;
+    const_iterator last = upper_bound(key);
+    for (const_iterator it = lower_bound(key); it != last; ++it) res++;
+    return res;
+  }
+
+  // Lookups through a non-const tree let the balancing policy adjust the
+  // tree to the key found (splay_balance moves it to the root). Const
+  // lookups never change the tree, so concurrent readers are safe.
+  iterator find(const key_type &key) {
+    if (bloom_rejects(key)) return iterator(nullptr);
+    return iterator(count_false_positive(find_node(key)));
+  }
+
+  const_iterator find(const key_type &key) const {
+    if (bloom_rejects(key)) return const_iterator(nullptr);
+    return const_iterator(count_false_positive(find_node(key)));
+  }
+
+  bool contains(const key_type &key) { return find(key) != end(); }
+
+  bool contains(const key_type &key) const { return find(key) != cend(); }
+
+  // Batched lookups: up to kLookupBatch descents advance one level at a time
+  // in lockstep and prefetch the next node of each, so their cache misses
+  // overlap instead of being paid one after another. The keys of a batch
+  // are read in place, so they must stay put while the iterator moves on.
+  template <class ForwardIt, class OutputIt>
+  OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out) const {
+    return lookup_many(first, last, out,
+                       [](node_type *node) { return iterator(node); });
+  }
+
+  template <class ForwardIt, class OutputIt>
+  OutputIt contains_many(ForwardIt first, ForwardIt last,
+                         OutputIt out) const {
+    return lookup_many(first, last, out,
+                       [](node_type *node) { return node != nullptr; });
+  }
+
+  // Internal iteration: fn(key, value) is called for every element in key
+  // order, or only for keys in [lo, hi), by a walk that needs no iterator
+  // and lets fn be inlined. If fn returns bool, false stops the walk.
+  template <class Fn>
+  void for_each(Fn fn) {
+    visit(root_, [&fn](node_type *node) {
+      return apply(fn, node->key, node->value);
+    });
+  }
+
+  template <class Fn>
+  void for_each(Fn fn) const {
+    visit(root_, [&fn](const node_type *node) {
+      return apply(fn, node->key, node->value);
+    });
+  }
+
+  template <class Fn>
+  void for_each_in_range(const key_type &lo, const key_type &hi, Fn fn) {
+    visit_range(root_, lo, hi, [&fn](node_type *node) {
+      return apply(fn, node->key, node->value);
+    });
+  }
+
+  template <class Fn>
+  void for_each_in_range(const key_type &lo, const key_type &hi,
+                         Fn fn) const {
+    visit_range(root_, lo, hi, [&fn](const node_type *node) {
+      return apply(fn, node->key, node->value);
+    });
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type &key) {
+    return std::make_pair(lower_bound(key), upper_bound(key));
+  }
+
+  iterator lower_bound(const key_type &key) {
+    node_type *node = bound_node(key, false);
+    return node ? iterator(node) : end();
+  }
+
+  const_iterator lower_bound(const key_type &key) const {
+    node_type *node = bound_node(key, false);
+    return node ? const_iterator(node) : cend();
+  }
+
+  iterator upper_bound(const key_type &key) {
+    node_type *node = bound_node(key, true);
+    return node ? iterator(node) : end();
+  }
+
+  const_iterator upper_bound(const key_type &key) const {
+    node_type *node = bound_node(key, true);
+    return node ? const_iterator(node) : cend();
+  }
+
+  // Moves all nodes into one contiguous buffer laid out in key order, so
+  // scans walk memory sequentially again after heavy insert/erase churn. The
+  // shape of the tree is kept; iterators obtained before the call are
+  // invalidated. Nodes inserted later are allocated one by one as usual.
+  void compact() {
+    if (root_ == nullptr) return;
+    stored_node *arena = alloc_traits::allocate(alloc(), size_);
+    size_type pos = 0;
+    root_ = relocate(root_, arena, pos);
+    release_arena();
+    arena_ = arena;
+    arena_size_ = pos;
+  }
+
+  // Puts a Bloom filter of bit_count bits in front of find, contains and
+  // count, so most lookups of absent keys skip the descent. Erased keys stay
+  // in the filter until rebuild_bloom_filter(); the erased_since_rebuild
+  // counter tells when that is worth it.
+  void enable_bloom_filter(size_type bit_count, size_type hash_count = 3) {
+    static_assert(is_hashable<key_type>::value,
+                  "the Bloom filter needs std::hash of the key type");
+    bloom_type *bloom = new bloom_type(bit_count, hash_count);
+    delete bloom_;
+    bloom_ = bloom;
+    rebuild_bloom_filter();
+  }
+
+  void disable_bloom_filter() noexcept {
+    delete bloom_;
+    bloom_ = nullptr;
+  }
+
+  void rebuild_bloom_filter() {
+    if (bloom_ == nullptr) return;
+    bloom_->clear();
+    for_each([this](const key_type &key, const value_type &) {
+      bloom_insert(key);
+    });
+  }
+
+  bool has_bloom_filter() const noexcept { return bloom_ != nullptr; }
+
+  bloom_stats get_bloom_stats() const noexcept {
+    return bloom_ != nullptr ? bloom_->stats() : bloom_stats();
+  }
+
+  // Merkle augmentation: every node caches the sum of the hashes of the
+  // (key, value) entries in its subtree. The sum does not depend on the
+  // shape, so trees holding the same entries have the same merkle_hash()
+  // whatever their insertion history, and diff() skips every key range
+  // whose sums agree. Values written in place through references are not
+  // seen until refresh_merkle(key) or rebuild_merkle(). Only trees declared
+  // with the merkle<> policy allocate room for the hashes.
+  void enable_merkle() {
+    static_assert(kMerkle, "declare the tree with the merkle<> policy");
+    static_assert(is_hashable<key_type>::value &&
+                      is_hashable<value_type>::value,
+                  "Merkle augmentation needs std::hash of keys and values");
+    merkle_ = true;
+    rebuild_merkle();
+  }
+
+  void disable_merkle() noexcept { merkle_ = false; }
+
+  bool has_merkle() const noexcept { return merkle_; }
+
+  void rebuild_merkle() {
+    if (merkle_) rebuild_hashes(root_);
+  }
+
+  // Refreshes the hashes after the value of key was changed in place.
+  void refresh_merkle(const key_type &key) {
+    if (!merkle_) return;
+    node_type *node = find_node(key);
+    if (node != nullptr) update_hashes_up(node);
+  }
+
+  std::size_t merkle_hash() const noexcept {
+    return merkle_ ? subtree_hash(root_) : 0;
+  }
+
+  // Calls fn(key) once for each key whose entries differ between the two
+  // trees (present in one only, or with other values), in key order. With
+  // the augmentation on both sides the cost grows with the number of
+  // differences rather than the size; otherwise both trees are walked.
+  template <class Fn>
+  void diff(const tree &other, Fn fn) const {
+    if (merkle_ && other.merkle_)
+      diff_range(other, nullptr, nullptr, fn);
+    else
+      diff_walk(other, fn);
+  }
+
+  node_type *get_root() const noexcept { return root_; }
+
+  bool get_is_multi() const { return is_multi_; }
+
+  void set_is_multi(bool is_multi) { this->is_multi_ = is_multi; }
+
+ private:
+  friend policy;
+
+  node_type *root_;
+  int size_;
+  bool is_multi_;
+  // Buffer filled by compact(); its nodes are destroyed in place instead of
+  // deleted, and the buffer itself is freed once the tree no longer uses it.
+  stored_node *arena_;
+  size_type arena_size_;
+  bloom_type *bloom_;
+  bool merkle_;
+
+  // Copies the subtree of other in preorder, following the parent links of
+  // other back up, so no stack grows with the depth. A partial copy is freed
+  // if a node cannot be made.
+  node_type *copy_node(const node_type *other) {
+    if (other == nullptr) return nullptr;
+    node_type *root = clone_node(other, nullptr);
+    node_type *copy = root;
+    const node_type *src = other;
+    try {
+      while (true) {
+        if (src->left != nullptr && copy->left == nullptr) {
+          copy->left = clone_node(src->left, copy);
+          src = src->left;
+          copy = copy->left;
+        } else if (src->right != nullptr && copy->right == nullptr) {
+          copy->right = clone_node(src->right, copy);
+          src = src->right;
+          copy = copy->right;
+        } else if (src != other) {
+          src = src->parent;
+          copy = copy->parent;
+        } else {
+          return root;
+        }
+      }
+    } catch (...) {
+      clear_node(root);
+      throw;
+    }
+  }
+
+  // Copies the entry of other along with its color, height and hash.
+  node_type *clone_node(const node_type *other, node_type *parent) {
+    node_type *new_node =
+        create_node(*static_cast<const stored_node *>(other));
+    new_node->parent = parent;
+    new_node->left = nullptr;
+    new_node->right = nullptr;
+    return new_node;
+  }
+
+  static constexpr size_type kLookupBatch = 16;
+
+  template <class ForwardIt, class OutputIt, class Emit>
+  OutputIt lookup_many(ForwardIt first, ForwardIt last, OutputIt out,
+                       Emit emit) const {
+    static_assert(
+        std::is_base_of_v<
+            std::forward_iterator_tag,
+            typename std::iterator_traits<ForwardIt>::iterator_category>,
+        "batched lookups keep pointers to the keys and need forward "
+        "iterators");
+    const key_type *keys[kLookupBatch];
+    node_type *curr[kLookupBatch];
+    node_type *found[kLookupBatch];
+    while (first != last) {
+      size_type batch = 0;
+      for (; batch < kLookupBatch && first != last; ++batch, ++first) {
+        keys[batch] = &*first;
+        curr[batch] = bloom_rejects(*first) ? nullptr : root_;
+        found[batch] = nullptr;
+      }
+      size_type lanes[kLookupBatch];
+      bool probed[kLookupBatch];
+      size_type active = 0;
+      for (size_type i = 0; i < batch; i++) {
+        probed[i] = curr[i] != nullptr;
+        if (probed[i]) lanes[active++] = i;
+      }
+      while (active) {
+        size_type still_active = 0;
+        for (size_type j = 0; j < active; j++) {
+          size_type i = lanes[j];
+          node_type *node = curr[i];
+          int cmp = compare_keys(*keys[i], node->key);
+          if (cmp == -1) {
+            node = node->left;
+          } else if (cmp == 1) {
+            node = node->right;
+          } else {
+            found[i] = node;
+            node = nullptr;
+          }
+          if (node) {
+            __builtin_prefetch(node);
+            lanes[still_active++] = i;
+          }
+          curr[i] = node;
+        }
+        active = still_active;
+      }
+      for (size_type i = 0; i < batch; i++) {
+        if (bloom_ != nullptr && probed[i] && found[i] == nullptr)
+          bloom_->stats().false_positives++;
+        *out = emit(found[i]);
+        ++out;
+      }
+    }
+    return out;
+  }
+
+  // First node whose key is not less than (upper: greater than) key, or
+  // nullptr. Descends once, so duplicates of a multi tree are found in order.
+  node_type *bound_node(const key_type &key, bool upper) const {
+    node_type *curr = root_;
+    node_type *res = nullptr;
+    while (curr != nullptr) {
+      if (upper ? key < curr->key : !(curr->key < key)) {
+        res = curr;
+        curr = curr->left;
+      } else {
+        curr = curr->right;
+      }
     }
     return res;
   }
 
-  iterator find(const key_type &key) const {
+  node_type *find_node(const key_type &key) {
+    int depth = 0;
+    node_type *search = descend(key, depth);
+    if (search) policy::after_find(*this, search, depth);
+    return search;
+  }
+
+  node_type *find_node(const key_type &key) const {
+    int depth = 0;
+    return descend(key, depth);
+  }
+
+  // Node holding key, or nullptr; depth is set to its distance from the
+  // root.
+  node_type *descend(const key_type &key, int &depth) const {
     auto *curr = root_;
-    node_type *search = nullptr;
     while (curr != nullptr) {
       if (compare_keys(key, curr->key) == -1) {
         curr = curr->left;
       } else if (compare_keys(key, curr->key) == 1) {
         curr = curr->right;
       } else {
-        search = curr;
-        break;
+        return curr;
       }
+      depth++;
     }
-    return iterator(search);
+    return nullptr;
   }
 
-  bool contains(const key_type &key) const { return find(key) != nullptr; }
+  node_type *count_false_positive(node_type *search) const {
+    if (bloom_ != nullptr && search == nullptr)
+      bloom_->stats().false_positives++;
+    return search;
+  }
 
-  std::pair<iterator, iterator> equal_range(const key_type &key) {
-    return std::make_pair(lower_bound(key), upper_bound(key));
+  static std::size_t subtree_hash(const node_type *node) noexcept {
+    if constexpr (kMerkle)
+      return node != nullptr ? static_cast<const stored_node *>(node)->hash
+                             : 0;
+    else
+      return 0;
   }
 
-  iterator lower_bound(const key_type &key) {
-    iterator it = begin();
-    for (size_type i = 0; i < size(); i++) {
-      if (it.get_key() >= key) {
-        return it;
-      }
-      it++;
+  static std::size_t entry_hash(const node_type *node) {
+    if constexpr (is_hashable<key_type>::value &&
+                  is_hashable<value_type>::value) {
+      std::uint64_t h = std::hash<key_type>()(node->key);
+      h = hash_mix(h) * 0x9e3779b97f4a7c15ULL +
+          std::hash<value_type>()(node->value);
+      return hash_mix(h);
+    } else {
+      return 0;
     }
-    return end();
   }
 
-  const_iterator lower_bound(const key_type &key) const {
-    const_iterator it = cbegin();
-    for (size_type i = 0; i < size(); i++) {
-      if (it.get_key() >= key) {
-        return it;
-      }
-      it++;
-    }
-    return end();
+  static void update_hash(node_type *node) {
+    if constexpr (kMerkle)
+      static_cast<stored_node *>(node)->hash = entry_hash(node) +
+                                               subtree_hash(node->left) +
+                                               subtree_hash(node->right);
   }
 
-  iterator upper_bound(const key_type &key) {
-    iterator it = begin();
-    for (size_type i = 0; i < size(); i++) {
-      if (it.get_key() > key) {
-        return it;
-      }
-      it++;
+  static void update_hashes_up(node_type *node) {
+    for (; node != nullptr; node = node->parent) update_hash(node);
+  }
+
+  // Postorder walk through the parent links: prev tells whether node was
+  // just entered from above or returned to from one of its children.
+  static void rebuild_hashes(node_type *node) {
+    node_type *prev = nullptr;
+    while (node != nullptr) {
+      node_type *next = node->parent;
+      if (prev == node->parent && node->left != nullptr)
+        next = node->left;
+      else if (prev != node->right && node->right != nullptr)
+        next = node->right;
+      else
+        update_hash(node);
+      prev = node;
+      node = next;
     }
-    return end();
   }
 
-  const_iterator upper_bound(const key_type &key) const {
-    const_iterator it = cbegin();
-    for (size_type i = 0; i < size(); i++) {
-      if (it.get_key() > key) {
-        return it;
+  // Sum of the entry hashes of the keys below key, or up to key inclusive.
+  std::size_t hash_below(const key_type &key, bool inclusive) const {
+    std::size_t res = 0;
+    for (const node_type *node = root_; node != nullptr;) {
+      if (node->key < key || (inclusive && !(key < node->key))) {
+        res += subtree_hash(node->left) + entry_hash(node);
+        node = node->right;
+      } else {
+        node = node->left;
       }
-      it++;
     }
-    return end();
+    return res;
   }
 
-  node_type *get_root() const noexcept { return root_; }
+  // Sum of the entry hashes of the keys in (lo, hi); a null bound is open.
+  std::size_t range_hash(const key_type *lo, const key_type *hi) const {
+    std::size_t res = hi ? hash_below(*hi, false) : subtree_hash(root_);
+    return lo ? res - hash_below(*lo, true) : res;
+  }
 
-  bool get_is_multi() { return is_multi_; }
+  // Highest node with a key in (lo, hi), it splits the range in two.
+  const node_type *split_node(const key_type *lo, const key_type *hi) const {
+    const node_type *node = root_;
+    while (node != nullptr) {
+      if (lo && !(*lo < node->key))
+        node = node->right;
+      else if (hi && !(node->key < *hi))
+        node = node->left;
+      else
+        break;
+    }
+    return node;
+  }
 
-  void set_is_multi(bool is_multi) { this->is_multi_ = is_multi; }
+  template <class Fn>
+  void diff_range(const tree &other, const key_type *lo, const key_type *hi,
+                  Fn &fn) const {
+    if (range_hash(lo, hi) == other.range_hash(lo, hi)) return;
+    const node_type *split = split_node(lo, hi);
+    if (split == nullptr) split = other.split_node(lo, hi);
+    if (split == nullptr) return;
+    key_type key = split->key;
+    diff_range(other, lo, &key, fn);
+    if (hash_below(key, true) - hash_below(key, false) !=
+        other.hash_below(key, true) - other.hash_below(key, false))
+      fn(key);
+    diff_range(other, &key, hi, fn);
+  }
 
- private:
-  node_type *root_;
-  int size_;
-  bool is_multi_;
+  template <class Fn>
+  void diff_walk(const tree &other, Fn &fn) const {
+    const_iterator lit = cbegin(), rit = other.cbegin();
+    const_iterator lend = cend(), rend = other.cend();
+    while (lit != lend || rit != rend) {
+      if (rit == rend || (lit != lend && lit.get_key() < rit.get_key())) {
+        fn(lit.get_key());
+        ++lit;
+      } else if (lit == lend || rit.get_key() < lit.get_key()) {
+        fn(rit.get_key());
+        ++rit;
+      } else {
+        if (!(*lit == *rit)) fn(lit.get_key());
+        ++lit;
+        ++rit;
+      }
+    }
+  }
 
-  node_type *copy_node(node_type *other, node_type *parent = NULL) {
-    if (other == NULL) {
-      return NULL;
+  // Counts the lookup and tells whether the filter rules the key out.
+  bool bloom_rejects(const key_type &key) const {
+    if (bloom_ == nullptr) return false;
+    bloom_stats &stats = bloom_->stats();
+    stats.lookups++;
+    if constexpr (is_hashable<key_type>::value) {
+      if (bloom_->might_contain(key)) return false;
     }
-    node_type *new_node = new node_type;
-    new_node->key = other->key;
-    new_node->value = other->value;
-    new_node->parent = parent;
-    new_node->color = other->color;
-    new_node->left = copy_node(other->left, new_node);
-    new_node->right = copy_node(other->right, new_node);
-    return new_node;
+    stats.rejected++;
+    return true;
+  }
+
+  // Only instantiates the hashing for hashable keys; other trees cannot
+  // enable the filter.
+  void bloom_insert(const key_type &key) {
+    if constexpr (is_hashable<key_type>::value) {
+      if (bloom_ != nullptr) bloom_->insert(key);
+    }
+  }
+
+  static bloom_type *copy_bloom(const bloom_type *bloom) {
+    return bloom != nullptr ? new bloom_type(*bloom) : nullptr;
   }
 
   int compare_keys(const K &first, const K &second) const {
@@ -546,69 +1061,222 @@ class tree {
     return res;
   }
 
+  // Number of elements with the key of it that come before it.
   size_type count_same_key_before_pos(const_iterator it) {
     if (!is_multi_) {
       return 0;
     }
-    value_type val = *it;
-    size_type count = -1;
-    if (it == cbegin()) {
-      return 0;
-    }
-    while (*it == val) {
+    node_type *node = it.get_pointer();
+    size_type count = 0;
+    for (const_iterator first = lower_bound(node->key);
+         first.get_pointer() != node; ++first) {
       count++;
-      it--;
-      if (it == cbegin()) {
-        count++;
-        break;
-      }
     }
     return count;
   }
 
+  template <class Fn, class V>
+  static bool apply(Fn &fn, const key_type &key, V &value) {
+    if constexpr (std::is_same_v<decltype(fn(key, value)), bool>) {
+      return fn(key, value);
+    } else {
+      fn(key, value);
+      return true;
+    }
+  }
+
+  static node_type *leftmost(node_type *node) noexcept {
+    while (node->left != nullptr) node = node->left;
+    return node;
+  }
+
+  // In-order successor through the parent links, null after the last node.
+  static node_type *next_node(node_type *node) noexcept {
+    if (node->right != nullptr) return leftmost(node->right);
+    node_type *parent = node->parent;
+    while (parent != nullptr && node == parent->right) {
+      node = parent;
+      parent = parent->parent;
+    }
+    return parent;
+  }
+
+  // Both walks step from node to node through the parent links, so they
+  // need no stack however deep the tree is.
+  template <class Visit>
+  static bool visit(node_type *root, const Visit &visit_node) {
+    if (root == nullptr) return true;
+    for (node_type *node = leftmost(root); node; node = next_node(node)) {
+      if (!visit_node(node)) return false;
+    }
+    return true;
+  }
+
+  template <class Visit>
+  static bool visit_range(node_type *root, const key_type &lo,
+                          const key_type &hi, const Visit &visit_node) {
+    node_type *first = nullptr;
+    for (node_type *node = root; node != nullptr;) {
+      if (node->key < lo) {
+        node = node->right;
+      } else {
+        first = node;
+        node = node->left;
+      }
+    }
+    for (; first != nullptr && first->key < hi; first = next_node(first)) {
+      if (!visit_node(first)) return false;
+    }
+    return true;
+  }
+
+  // Frees the subtree without a stack: a left child is rotated up until the
+  // node at hand has none, then the node is freed and its right child taken.
   void clear_node(node_type *node) noexcept {
-    if (node->left != nullptr) clear_node(node->left);
-    if (node->right != nullptr) clear_node(node->right);
-    delete node;
+    while (node != nullptr) {
+      node_type *left = node->left;
+      if (left != nullptr) {
+        node->left = left->right;
+        left->right = node;
+        node = left;
+      } else {
+        node_type *right = node->right;
+        free_node(node);
+        node = right;
+      }
+    }
   }
 
-  void delete_node(Node<K, T> *node) {
-    if (node->left == nullptr && node->right == nullptr) {
-      if (node->color == BLACK) rebalance_after_extract(node);
-      if (node->parent->left == node)
-        node->parent->left = nullptr;
-      else
-        node->parent->right = nullptr;
-      delete node;
-    } else {
-      node_type *node_to_swap = nullptr;
-      if (node->left != nullptr && node->right != nullptr)
-        node_to_swap = get_node_to_swap(node);
-      else
-        node_to_swap = (node->left == nullptr) ? node->right : node->left;
-      node->key = node_to_swap->key;
-      node->value = node_to_swap->value;
-      delete_node(node_to_swap);
+  void free_node(node_type *node) noexcept {
+    if (arena_ != nullptr && node >= arena_ && node < arena_ + arena_size_)
+      alloc_traits::destroy(alloc(), static_cast<stored_node *>(node));
+    else
+      destroy_node(node);
+  }
+
+  void release_arena() noexcept {
+    if (arena_ != nullptr) {
+      alloc_traits::deallocate(alloc(), arena_, arena_size_);
+    }
+    arena_ = nullptr;
+    arena_size_ = 0;
+  }
+
+  // Constructs the node from a key and a value or from another node. The
+  // entry is copy constructed, so values keep the allocator they were built
+  // with, e.g. the buckets of bucket_multimap.
+  template <class... Args>
+  node_type *create_node(const Args &... args) {
+    stored_node *node = alloc_traits::allocate(alloc(), 1);
+    try {
+      alloc_traits::construct(alloc(), node, args...);
+    } catch (...) {
+      alloc_traits::deallocate(alloc(), node, 1);
+      throw;
     }
+    return node;
+  }
+
+  void destroy_node(node_type *node) noexcept {
+    stored_node *stored = static_cast<stored_node *>(node);
+    alloc_traits::destroy(alloc(), stored);
+    alloc_traits::deallocate(alloc(), stored, 1);
+  }
+
+  // Frees every node and the arena; the Bloom filter is left alone.
+  void release() noexcept {
+    if (root_ != nullptr) clear_node(root_);
+    release_arena();
+    root_ = nullptr;
+    size_ = 0;
+  }
+
+  // Copies the nodes and settings of other into this empty tree.
+  void copy_from(const tree &other) {
+    bloom_type *bloom = copy_bloom(other.bloom_);
+    delete bloom_;
+    bloom_ = bloom;
+    root_ = copy_node(other.root_);
+    size_ = other.size_;
+    is_multi_ = other.is_multi_;
+    merkle_ = other.merkle_;
+  }
+
+  // Moves the nodes and settings of other into this empty tree, leaving
+  // other empty and without a Bloom filter.
+  void steal(tree &other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(size_, other.size_);
+    is_multi_ = other.is_multi_;
+    std::swap(arena_, other.arena_);
+    std::swap(arena_size_, other.arena_size_);
+    delete bloom_;
+    bloom_ = other.bloom_;
+    other.bloom_ = nullptr;
+    merkle_ = other.merkle_;
   }
 
-  node_type *get_node_to_swap(const node_type *node) {
-    node_type *max_left = node->left;
-    node_type *min_right = node->right;
-    int left_count = 0, right_count = 0;
-    auto *curr = max_left;
-    while (curr->right != nullptr) {
-      max_left = curr->right;
-      left_count++;
-      curr = curr->right;
+  // Copies the tree into the arena in key order and frees the originals,
+  // walking through the parent links. Once a node is copied its left link is
+  // no longer followed and holds the copy instead. A finished left subtree
+  // is linked to the copy made next, the one of its parent; a finished right
+  // subtree to the copy its parent holds.
+  node_type *relocate(node_type *root, stored_node *arena, size_type &pos) {
+    node_type *node = leftmost(root);
+    node_type *left_copy = nullptr;
+    while (true) {
+      stored_node *copy = arena + pos++;
+      alloc_traits::construct(alloc(), copy,
+                              *static_cast<stored_node *>(node));
+      copy->parent = nullptr;
+      copy->left = left_copy;
+      copy->right = nullptr;
+      if (left_copy != nullptr) left_copy->parent = copy;
+      left_copy = nullptr;
+      node->left = copy;
+      if (node->right != nullptr) {
+        node = leftmost(node->right);
+        continue;
+      }
+      while (true) {
+        node_type *parent = node->parent;
+        node_type *done = node->left;
+        bool is_right = parent != nullptr && parent->right == node;
+        free_node(node);
+        if (parent == nullptr) return done;
+        node = parent;
+        if (!is_right) {
+          left_copy = done;
+          break;
+        }
+        done->parent = parent->left;
+        parent->left->right = done;
+      }
     }
-    curr = min_right;
-    while (curr->left != nullptr) {
-      min_right = curr->left;
-      right_count++;
-      curr = curr->left;
+  }
+
+  // Plain binary search tree removal, the balancing policy restores the
+  // balance afterwards. Returns the parent of the node actually freed.
+  node_type *unlink_node(node_type *node) {
+    if (node->left != nullptr && node->right != nullptr) {
+      node_type *next = node->right;
+      while (next->left != nullptr) next = next->left;
+      node->key = next->key;
+      node->value = next->value;
+      node = next;
     }
-    return (left_count >= right_count) ? max_left : min_right;
+    node_type *child = (node->left == nullptr) ? node->right : node->left;
+    if (child != nullptr) child->parent = node->parent;
+    if (node == root_)
+      root_ = child;
+    else if (node->parent->left == node)
+      node->parent->left = child;
+    else
+      node->parent->right = child;
+    node_type *parent = node->parent;
+    free_node(node);
+    if (merkle_) update_hashes_up(parent);
+    return parent;
   }
 
   void left_rotate(Node<key_type, value_type> *node) {
@@ -618,14 +1286,16 @@ class tree {
     temp->left = node;
     temp->parent = node->parent;
     node->parent = temp;
-    if (root_ == node) {
+    if (root_ == node)
       root_ = temp;
-      return;
-    }
-    if (temp->parent->left == node)
+    else if (temp->parent->left == node)
       temp->parent->left = temp;
     else
       temp->parent->right = temp;
+    if (merkle_) {
+      update_hash(node);
+      update_hash(temp);
+    }
   }
 
   void right_rotate(node_type *node) {
@@ -635,88 +1305,54 @@ class tree {
     temp->right = node;
     temp->parent = node->parent;
     node->parent = temp;
-    if (root_ == node) {
+    if (root_ == node)
       root_ = temp;
-      return;
-    }
-    if (temp->parent->left == node)
+    else if (temp->parent->left == node)
       temp->parent->left = temp;
     else
       temp->parent->right = temp;
+    if (merkle_) {
+      update_hash(node);
+      update_hash(temp);
+    }
   }
 
-  void rebalance_after_extract(node_type *node) {
-    if (node == root_) return;
-    auto *parent = node->parent;
-    bool is_left = (node == parent->left);
-    auto *sibling = is_left ? parent->right : parent->left;
-
-    if (sibling->color == BLACK) {
-      if ((sibling->left != nullptr && sibling->left->color == RED) ||
-          (sibling->right != nullptr && sibling->right->color == RED)) {
-        rebalance_when_one_child_is_red(node, parent, is_left);
-      } else {
-        int parent_color = parent->color;
-        sibling->color = RED;
-        parent->color = BLACK;
-        if (parent_color == BLACK) rebalance_after_extract(parent);
-      }
-    } else {
-      parent->color = RED;
-      sibling->color = BLACK;
-      is_left ? left_rotate(parent) : right_rotate(parent);
-      rebalance_after_extract(node);
-    }
-  }
-
-  void rebalance_when_one_child_is_red(node_type *node, node_type *parent,
-                                       bool is_left) {
-    auto *sibling = is_left ? parent->right : parent->left;
-    if ((is_left && sibling->right != nullptr &&
-         sibling->right->color == RED) ||
-        (!is_left && sibling->left != nullptr && sibling->left->color == RED)) {
-      sibling->color = parent->color;
-      parent->color = BLACK;
-      is_left ? sibling->right->color = BLACK : sibling->left->color = BLACK;
-      is_left ? left_rotate(parent) : right_rotate(parent);
+  void rotate_up(node_type *node) {
+    node_type *parent = node->parent;
+    node_type *grand = parent->parent;
+    if (parent->left == node) {
+      parent->left = node->right;
+      if (node->right) node->right->parent = parent;
+      node->right = parent;
     } else {
-      is_left ? sibling->left->color = BLACK : sibling->right->color = BLACK;
-      sibling->color = RED;
-      is_left ? right_rotate(sibling) : left_rotate(sibling);
-      rebalance_when_one_child_is_red(node, parent, is_left);
+      parent->right = node->left;
+      if (node->left) node->left->parent = parent;
+      node->left = parent;
     }
-  }
-
-  void update_tree_after_insert(node_type *curr, node_type *node) {
-    while (curr->color == RED && curr->parent != nullptr) {
-      bool is_right = (curr == curr->parent->right);
-      auto *uncle = (is_right) ? curr->parent->left : curr->parent->right;
-
-      if (uncle != nullptr && uncle->color == RED) {
-        curr->color = BLACK;
-        uncle->color = BLACK;
-        if (curr->parent != root_) curr->parent->color = RED;
-        curr = curr->parent;
-        if (curr->parent == nullptr || curr->parent->color == BLACK) break;
-      } else {
-        if ((is_right && node == curr->left) ||
-            (!is_right && node == curr->right)) {
-          is_right ? right_rotate(curr) : left_rotate(curr);
-          curr = node;
-        }
-        curr->color = BLACK;
-        curr->parent->color = RED;
-        is_right ? left_rotate(curr->parent) : right_rotate(curr->parent);
-      }
+    parent->parent = node;
+    node->parent = grand;
+    if (grand == nullptr)
+      root_ = node;
+    else if (grand->left == parent)
+      grand->left = node;
+    else
+      grand->right = node;
+    if (merkle_) {
+      update_hash(parent);
+      update_hash(node);
     }
   }
-};  // namespace s21
+};
 
-template <class K, class T>
-bool operator==(const tree<K, T> &lhs, const tree<K, T> &rhs) {
+template <class K, class T, class B, class A>
+bool operator==(const tree<K, T, B, A> &lhs, const tree<K, T, B, A> &rhs) {
   if (lhs.size() != rhs.size()) {
     return false;
   }
+  if (lhs.has_merkle() && rhs.has_merkle() &&
+      lhs.merkle_hash() != rhs.merkle_hash()) {
+    return false;
+  }
   s21::TreeConstIterator lit = lhs.begin();
   s21::TreeConstIterator rit = rhs.begin();
   for (std::size_t i = 0; i < lhs.size(); i++) {
@@ -731,13 +1367,13 @@ bool operator==(const tree<K, T> &lhs, const tree<K, T> &rhs) {
   return true;
 }
 
-template <class K, class T>
-bool operator!=(const tree<K, T> &lhs, const tree<K, T> &rhs) {
+template <class K, class T, class B, class A>
+bool operator!=(const tree<K, T, B, A> &lhs, const tree<K, T, B, A> &rhs) {
   return !(lhs == rhs);
 }
 
-template <class K, class T>
-bool operator<(const tree<K, T> &lhs, const tree<K, T> &rhs) {
+template <class K, class T, class B, class A>
+bool operator<(const tree<K, T, B, A> &lhs, const tree<K, T, B, A> &rhs) {
   if (lhs.size() < rhs.size()) {
     return true;
   } else if (lhs.size() > rhs.size()) {
@@ -760,18 +1396,18 @@ bool operator<(const tree<K, T> &lhs, const tree<K, T> &rhs) {
   }
 }
 
-template <class K, class T>
-bool operator<=(const tree<K, T> &lhs, const tree<K, T> &rhs) {
+template <class K, class T, class B, class A>
+bool operator<=(const tree<K, T, B, A> &lhs, const tree<K, T, B, A> &rhs) {
   return lhs == rhs || lhs < rhs;
 }
 
-template <class K, class T>
-bool operator>(const tree<K, T> &lhs, const tree<K, T> &rhs) {
+template <class K, class T, class B, class A>
+bool operator>(const tree<K, T, B, A> &lhs, const tree<K, T, B, A> &rhs) {
   return !(lhs <= rhs);
 }
 
-template <class K, class T>
-bool operator>=(const tree<K, T> &lhs, const tree<K, T> &rhs) {
+template <class K, class T, class B, class A>
+bool operator>=(const tree<K, T, B, A> &lhs, const tree<K, T, B, A> &rhs) {
   return lhs == rhs || lhs > rhs;
 }
 
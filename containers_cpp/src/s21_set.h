@@ -1,28 +1,32 @@
 #ifndef S21_CONTAINERS_SRC_S21_SET_H
 #define S21_CONTAINERS_SRC_S21_SET_H
 
+#include "s21_frozen_tree.h"
 #include "s21_rbtree.h"
 
 namespace s21 {
-template <class K, class Compare = std::less<K>>
+template <class K, class Compare = std::less<K>,
+          class Allocator = std::allocator<K>, class Balance = rb_balance>
 class set {
  public:
   using key_type = K;
   using value_type = K;
   using node_type = Node<key_type, value_type>;
-  using tree_type = tree<key_type, value_type>;
+  using tree_type = tree<key_type, value_type, Balance, Allocator>;
+  using balance_type = Balance;
+  using allocator_type = Allocator;
+  using frozen_type = frozen_tree<key_type, value_type>;
   using size_type = std::size_t;
   using iterator = TreeIterator<key_type, value_type>;
   using const_iterator = TreeConstIterator<key_type, value_type>;
 
   set() {}
 
-  set(const set& other) { tree_ = other.tree_; }
+  explicit set(const allocator_type& alloc) : tree_(alloc) {}
 
-  set(set&& other) {
-    tree_ = std::move(other.tree_);
-    other.clear();
-  }
+  set(const set& other) : tree_(other.tree_) {}
+
+  set(set&& other) noexcept : tree_(std::move(other.tree_)) {}
 
   set(std::initializer_list<value_type> init) { *this = init; }
 
@@ -104,7 +108,7 @@ class set {
   void swap(set& other) noexcept { tree_.swap(other.tree_); }
 
   node_type extract(const_iterator position) {
-    return extract(position.get_key());
+    return tree_.extract(position);
   }
 
   node_type extract(const key_type& k) {
@@ -122,12 +126,27 @@ class set {
 
   size_type count(const key_type& key) const { return tree_.count(key); }
 
+  // A lookup on a non-const splay container moves the key found towards the
+  // root; const lookups leave the tree as it is and may run concurrently.
   iterator find(const key_type& key) { return iterator(tree_.find(key)); }
 
   const_iterator find(const key_type& key) const { return tree_.find(key); }
 
+  bool contains(const key_type& key) { return tree_.contains(key); }
+
   bool contains(const key_type& key) const { return tree_.contains(key); }
 
+  template <class ForwardIt, class OutputIt>
+  OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out) const {
+    return tree_.find_many(first, last, out);
+  }
+
+  template <class ForwardIt, class OutputIt>
+  OutputIt contains_many(ForwardIt first, ForwardIt last,
+                         OutputIt out) const {
+    return tree_.contains_many(first, last, out);
+  }
+
   std::pair<iterator, iterator> equal_range(const key_type& key) {
     return tree_.equal_range(key);
   }
@@ -144,7 +163,73 @@ class set {
     return tree_.upper_bound(key);
   }
 
-  tree_type get_tree() const noexcept { return tree_; }
+  // Calls fn(key) for every key in order, or for keys in [lo, hi). If fn
+  // returns bool, false stops the walk.
+  template <class Fn>
+  void for_each(Fn fn) const {
+    tree_.for_each(
+        [&fn](const key_type& key, const value_type&) { return fn(key); });
+  }
+
+  template <class Fn>
+  void for_each_in_range(const key_type& lo, const key_type& hi,
+                         Fn fn) const {
+    tree_.for_each_in_range(
+        lo, hi,
+        [&fn](const key_type& key, const value_type&) { return fn(key); });
+  }
+
+  // Appends all keys, in order, to out.
+  void copy_keys_to(vector<key_type>& out) const {
+    out.reserve(out.size() + size());
+    tree_.for_each([&out](const key_type& key, const value_type&) {
+      out.push_back(key);
+    });
+  }
+
+  // Relocates the nodes into one contiguous buffer in key order, see
+  // tree::compact(). Invalidates iterators.
+  void compact() { tree_.compact(); }
+
+  // Bloom filter in front of find/contains/count, see
+  // tree::enable_bloom_filter().
+  void enable_bloom_filter(size_type bit_count, size_type hash_count = 3) {
+    tree_.enable_bloom_filter(bit_count, hash_count);
+  }
+
+  void disable_bloom_filter() noexcept { tree_.disable_bloom_filter(); }
+
+  void rebuild_bloom_filter() { tree_.rebuild_bloom_filter(); }
+
+  bloom_stats get_bloom_stats() const noexcept {
+    return tree_.get_bloom_stats();
+  }
+
+  // Keeps a hash of every subtree, see tree::enable_merkle(); only for a
+  // Balance of the form merkle<...>. Comparing replicas then fails fast on a
+  // hash mismatch, and diff() descends only into the key ranges that differ.
+  void enable_merkle() { tree_.enable_merkle(); }
+
+  void disable_merkle() noexcept { tree_.disable_merkle(); }
+
+  std::size_t merkle_hash() const noexcept { return tree_.merkle_hash(); }
+
+  // Keys whose entries differ between the two containers, in order.
+  vector<key_type> diff(const set& other) const {
+    vector<key_type> keys;
+    tree_.diff(other.tree_, [&keys](const key_type& key) {
+      keys.push_back(key);
+    });
+    return keys;
+  }
+
+  frozen_type freeze() const { return frozen_type(tree_); }
+
+  allocator_type get_allocator() const noexcept {
+    return tree_.get_allocator();
+  }
+
+  const tree_type& get_tree() const noexcept { return tree_; }
 
   tree_type* get_tree_ptr() noexcept { return &tree_; }
 
@@ -152,33 +237,33 @@ class set {
   tree_type tree_;
 };
 
-template <class K>
-bool operator==(const set<K>& lhs, const set<K>& rhs) {
+template <class K, class C, class A, class B>
+bool operator==(const set<K, C, A, B>& lhs, const set<K, C, A, B>& rhs) {
   return lhs.get_tree() == rhs.get_tree();
 }
 
-template <class K>
-bool operator!=(const set<K>& lhs, const set<K>& rhs) {
+template <class K, class C, class A, class B>
+bool operator!=(const set<K, C, A, B>& lhs, const set<K, C, A, B>& rhs) {
   return !(lhs == rhs);
 }
 
-template <class K>
-bool operator<(const set<K>& lhs, const set<K>& rhs) {
+template <class K, class C, class A, class B>
+bool operator<(const set<K, C, A, B>& lhs, const set<K, C, A, B>& rhs) {
   return lhs.get_tree() < rhs.get_tree();
 }
 
-template <class K>
-bool operator<=(const set<K>& lhs, const set<K>& rhs) {
+template <class K, class C, class A, class B>
+bool operator<=(const set<K, C, A, B>& lhs, const set<K, C, A, B>& rhs) {
   return lhs.get_tree() <= rhs.get_tree();
 }
 
-template <class K>
-bool operator>(const set<K>& lhs, const set<K>& rhs) {
+template <class K, class C, class A, class B>
+bool operator>(const set<K, C, A, B>& lhs, const set<K, C, A, B>& rhs) {
   return lhs.get_tree() > rhs.get_tree();
 }
 
-template <class K>
-bool operator>=(const set<K>& lhs, const set<K>& rhs) {
+template <class K, class C, class A, class B>
+bool operator>=(const set<K, C, A, B>& lhs, const set<K, C, A, B>& rhs) {
   return lhs.get_tree() >= rhs.get_tree();
 }
 
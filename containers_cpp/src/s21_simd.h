@@ -0,0 +1,416 @@
+#ifndef S21_CONTAINERS_SRC_S21_SIMD_H
+#define S21_CONTAINERS_SRC_S21_SIMD_H
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define S21_SIMD_X86 1
+#endif
+
+// Vectorized kernels over contiguous arrays of arithmetic elements, used by
+// vector and array for comparisons, search and fill. Each kernel exists for
+// AVX2, SSE2 and plain C++; the fastest one the CPU supports is picked at
+// run time, so the library is built without -mavx2 and still runs on any
+// x86-64 machine. Other architectures always take the scalar kernels.
+namespace s21 {
+namespace simd {
+
+using size_type = std::size_t;
+
+// Instruction sets the kernels can use, from slowest to fastest.
+enum class level { scalar, sse2, avx2 };
+
+// Element types the kernels handle: arithmetic types whose equality can be
+// decided lane by lane in a vector register.
+template <class T>
+inline constexpr bool is_vectorizable_v =
+    std::is_arithmetic_v<T> && (sizeof(T) == 1 || sizeof(T) == 2 ||
+                                sizeof(T) == 4 || sizeof(T) == 8);
+
+// Best level the CPU supports.
+inline level detected_level() noexcept {
+#ifdef S21_SIMD_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) return level::avx2;
+  if (__builtin_cpu_supports("sse2")) return level::sse2;
+#endif
+  return level::scalar;
+}
+
+namespace internal {
+inline level &current_level() noexcept {
+  static level current = detected_level();
+  return current;
+}
+}  // namespace internal
+
+// Level the kernels dispatch to.
+inline level active_level() noexcept { return internal::current_level(); }
+
+// Caps the level the kernels dispatch to, e.g. to compare them in a
+// benchmark; a level above detected_level() is lowered to it. Returns the
+// previous level. Not safe to call while kernels run on other threads.
+inline level set_level(level wanted) noexcept {
+  level previous = internal::current_level();
+  internal::current_level() = std::min(wanted, detected_level());
+  return previous;
+}
+
+namespace scalar {
+template <class T>
+size_type mismatch(const T *a, const T *b, size_type n) {
+  for (size_type i = 0; i < n; i++) {
+    if (!(a[i] == b[i])) return i;
+  }
+  return n;
+}
+
+template <class T>
+size_type find(const T *a, size_type n, T value) {
+  for (size_type i = 0; i < n; i++) {
+    if (a[i] == value) return i;
+  }
+  return n;
+}
+
+template <class T>
+size_type count(const T *a, size_type n, T value) {
+  size_type found = 0;
+  for (size_type i = 0; i < n; i++) found += a[i] == value;
+  return found;
+}
+
+template <class T>
+void fill(T *a, size_type n, T value) {
+  for (size_type i = 0; i < n; i++) a[i] = value;
+}
+}  // namespace scalar
+
+#ifdef S21_SIMD_X86
+// The masks below have one bit per byte of the register, set where the
+// element covering that byte compares equal, as _mm_movemask_epi8 makes
+// them; the index of an element is its first bit divided by sizeof(T).
+namespace sse2 {
+constexpr size_type kBytes = 16;
+constexpr unsigned kAllLanes = 0xFFFF;
+
+template <class T>
+__attribute__((target("sse2"), always_inline)) inline __m128i load(
+    const T *p) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+}
+
+template <class T>
+__attribute__((target("sse2"), always_inline)) inline __m128i broadcast(
+    T value) {
+  if constexpr (std::is_same_v<T, float>) {
+    return _mm_castps_si128(_mm_set1_ps(value));
+  } else if constexpr (std::is_same_v<T, double>) {
+    return _mm_castpd_si128(_mm_set1_pd(value));
+  } else if constexpr (sizeof(T) == 1) {
+    return _mm_set1_epi8(static_cast<char>(value));
+  } else if constexpr (sizeof(T) == 2) {
+    return _mm_set1_epi16(static_cast<short>(value));
+  } else if constexpr (sizeof(T) == 4) {
+    return _mm_set1_epi32(static_cast<int>(value));
+  } else {
+    return _mm_set1_epi64x(static_cast<long long>(value));
+  }
+}
+
+template <class T>
+__attribute__((target("sse2"), always_inline)) inline unsigned eq_mask(
+    __m128i a, __m128i b) {
+  __m128i eq;
+  if constexpr (std::is_same_v<T, float>) {
+    eq = _mm_castps_si128(
+        _mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+  } else if constexpr (std::is_same_v<T, double>) {
+    eq = _mm_castpd_si128(
+        _mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+  } else if constexpr (sizeof(T) == 1) {
+    eq = _mm_cmpeq_epi8(a, b);
+  } else if constexpr (sizeof(T) == 2) {
+    eq = _mm_cmpeq_epi16(a, b);
+  } else if constexpr (sizeof(T) == 4) {
+    eq = _mm_cmpeq_epi32(a, b);
+  } else {
+    // SSE2 has no 64-bit compare: both 32-bit halves must match.
+    eq = _mm_cmpeq_epi32(a, b);
+    eq = _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+  }
+  return static_cast<unsigned>(_mm_movemask_epi8(eq));
+}
+
+template <class T>
+__attribute__((target("sse2"))) size_type mismatch(const T *a, const T *b,
+                                                   size_type n) {
+  constexpr size_type kLanes = kBytes / sizeof(T);
+  size_type i = 0;
+  for (; i + kLanes <= n; i += kLanes) {
+    unsigned ne = ~eq_mask<T>(load(a + i), load(b + i)) & kAllLanes;
+    if (ne) return i + __builtin_ctz(ne) / sizeof(T);
+  }
+  return i + scalar::mismatch(a + i, b + i, n - i);
+}
+
+template <class T>
+__attribute__((target("sse2"))) size_type find(const T *a, size_type n,
+                                               T value) {
+  constexpr size_type kLanes = kBytes / sizeof(T);
+  const __m128i needle = broadcast(value);
+  size_type i = 0;
+  for (; i + kLanes <= n; i += kLanes) {
+    unsigned eq = eq_mask<T>(load(a + i), needle);
+    if (eq) return i + __builtin_ctz(eq) / sizeof(T);
+  }
+  return i + scalar::find(a + i, n - i, value);
+}
+
+template <class T>
+__attribute__((target("sse2"))) size_type count(const T *a, size_type n,
+                                                T value) {
+  constexpr size_type kLanes = kBytes / sizeof(T);
+  const __m128i needle = broadcast(value);
+  size_type bytes = 0;
+  size_type i = 0;
+  for (; i + kLanes <= n; i += kLanes) {
+    bytes += __builtin_popcount(eq_mask<T>(load(a + i), needle));
+  }
+  return bytes / sizeof(T) + scalar::count(a + i, n - i, value);
+}
+
+template <class T>
+__attribute__((target("sse2"))) void fill(T *a, size_type n, T value) {
+  constexpr size_type kLanes = kBytes / sizeof(T);
+  const __m128i v = broadcast(value);
+  size_type i = 0;
+  for (; i + kLanes <= n; i += kLanes) {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(a + i), v);
+  }
+  scalar::fill(a + i, n - i, value);
+}
+}  // namespace sse2
+
+namespace avx2 {
+constexpr size_type kBytes = 32;
+
+template <class T>
+__attribute__((target("avx2"), always_inline)) inline __m256i load(
+    const T *p) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+}
+
+template <class T>
+__attribute__((target("avx2"), always_inline)) inline __m256i broadcast(
+    T value) {
+  if constexpr (std::is_same_v<T, float>) {
+    return _mm256_castps_si256(_mm256_set1_ps(value));
+  } else if constexpr (std::is_same_v<T, double>) {
+    return _mm256_castpd_si256(_mm256_set1_pd(value));
+  } else if constexpr (sizeof(T) == 1) {
+    return _mm256_set1_epi8(static_cast<char>(value));
+  } else if constexpr (sizeof(T) == 2) {
+    return _mm256_set1_epi16(static_cast<short>(value));
+  } else if constexpr (sizeof(T) == 4) {
+    return _mm256_set1_epi32(static_cast<int>(value));
+  } else {
+    return _mm256_set1_epi64x(static_cast<long long>(value));
+  }
+}
+
+template <class T>
+__attribute__((target("avx2"), always_inline)) inline unsigned eq_mask(
+    __m256i a, __m256i b) {
+  __m256i eq;
+  if constexpr (std::is_same_v<T, float>) {
+    eq = _mm256_castps_si256(_mm256_cmp_ps(
+        _mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+  } else if constexpr (std::is_same_v<T, double>) {
+    eq = _mm256_castpd_si256(_mm256_cmp_pd(
+        _mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+  } else if constexpr (sizeof(T) == 1) {
+    eq = _mm256_cmpeq_epi8(a, b);
+  } else if constexpr (sizeof(T) == 2) {
+    eq = _mm256_cmpeq_epi16(a, b);
+  } else if constexpr (sizeof(T) == 4) {
+    eq = _mm256_cmpeq_epi32(a, b);
+  } else {
+    eq = _mm256_cmpeq_epi64(a, b);
+  }
+  return static_cast<unsigned>(_mm256_movemask_epi8(eq));
+}
+
+// The search loops look at two registers per iteration and only work out
+// which one matched once either did.
+template <class T>
+__attribute__((target("avx2"))) size_type mismatch(const T *a, const T *b,
+                                                   size_type n) {
+  constexpr size_type kLanes = kBytes / sizeof(T);
+  size_type i = 0;
+  for (; i + 2 * kLanes <= n; i += 2 * kLanes) {
+    unsigned lo = eq_mask<T>(load(a + i), load(b + i));
+    unsigned hi = eq_mask<T>(load(a + i + kLanes), load(b + i + kLanes));
+    if ((lo & hi) != ~0u) {
+      if (lo != ~0u) return i + __builtin_ctz(~lo) / sizeof(T);
+      return i + kLanes + __builtin_ctz(~hi) / sizeof(T);
+    }
+  }
+  for (; i + kLanes <= n; i += kLanes) {
+    unsigned eq = eq_mask<T>(load(a + i), load(b + i));
+    if (eq != ~0u) return i + __builtin_ctz(~eq) / sizeof(T);
+  }
+  return i + scalar::mismatch(a + i, b + i, n - i);
+}
+
+template <class T>
+__attribute__((target("avx2"))) size_type find(const T *a, size_type n,
+                                               T value) {
+  constexpr size_type kLanes = kBytes / sizeof(T);
+  const __m256i needle = broadcast(value);
+  size_type i = 0;
+  for (; i + 2 * kLanes <= n; i += 2 * kLanes) {
+    unsigned lo = eq_mask<T>(load(a + i), needle);
+    unsigned hi = eq_mask<T>(load(a + i + kLanes), needle);
+    if (lo | hi) {
+      if (lo) return i + __builtin_ctz(lo) / sizeof(T);
+      return i + kLanes + __builtin_ctz(hi) / sizeof(T);
+    }
+  }
+  for (; i + kLanes <= n; i += kLanes) {
+    unsigned eq = eq_mask<T>(load(a + i), needle);
+    if (eq) return i + __builtin_ctz(eq) / sizeof(T);
+  }
+  return i + scalar::find(a + i, n - i, value);
+}
+
+template <class T>
+__attribute__((target("avx2"))) size_type count(const T *a, size_type n,
+                                                T value) {
+  constexpr size_type kLanes = kBytes / sizeof(T);
+  const __m256i needle = broadcast(value);
+  size_type bytes = 0;
+  size_type i = 0;
+  for (; i + kLanes <= n; i += kLanes) {
+    bytes += __builtin_popcount(eq_mask<T>(load(a + i), needle));
+  }
+  return bytes / sizeof(T) + scalar::count(a + i, n - i, value);
+}
+
+template <class T>
+__attribute__((target("avx2"))) void fill(T *a, size_type n, T value) {
+  constexpr size_type kLanes = kBytes / sizeof(T);
+  const __m256i v = broadcast(value);
+  size_type i = 0;
+  for (; i + kLanes <= n; i += kLanes) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(a + i), v);
+  }
+  scalar::fill(a + i, n - i, value);
+}
+}  // namespace avx2
+#endif  // S21_SIMD_X86
+
+// Front ends used by the containers. For vectorizable element types they
+// dispatch to the kernels of active_level(); any other type goes through
+// the standard algorithms, so callers need not check the trait.
+
+// Index of the first i with !(a[i] == b[i]), or n.
+template <class T>
+size_type mismatch(const T *a, const T *b, size_type n) {
+  if constexpr (is_vectorizable_v<T>) {
+#ifdef S21_SIMD_X86
+    switch (active_level()) {
+      case level::avx2:
+        return avx2::mismatch(a, b, n);
+      case level::sse2:
+        return sse2::mismatch(a, b, n);
+      case level::scalar:
+        break;
+    }
+#endif
+  }
+  return scalar::mismatch(a, b, n);
+}
+
+// Index of the first element equal to value, or n.
+template <class T>
+size_type find(const T *a, size_type n, const T &value) {
+  if constexpr (is_vectorizable_v<T>) {
+#ifdef S21_SIMD_X86
+    switch (active_level()) {
+      case level::avx2:
+        return avx2::find(a, n, value);
+      case level::sse2:
+        return sse2::find(a, n, value);
+      case level::scalar:
+        break;
+    }
+#endif
+  }
+  return std::find(a, a + n, value) - a;
+}
+
+// Number of elements equal to value.
+template <class T>
+size_type count(const T *a, size_type n, const T &value) {
+  if constexpr (is_vectorizable_v<T>) {
+#ifdef S21_SIMD_X86
+    switch (active_level()) {
+      case level::avx2:
+        return avx2::count(a, n, value);
+      case level::sse2:
+        return sse2::count(a, n, value);
+      case level::scalar:
+        break;
+    }
+#endif
+  }
+  return std::count(a, a + n, value);
+}
+
+// Assigns value to the n elements at a. For vectorizable types a may also
+// be raw storage, since their objects need no construction.
+template <class T>
+void fill(T *a, size_type n, const T &value) {
+  if constexpr (is_vectorizable_v<T>) {
+#ifdef S21_SIMD_X86
+    switch (active_level()) {
+      case level::avx2:
+        return avx2::fill(a, n, value);
+      case level::sse2:
+        return sse2::fill(a, n, value);
+      case level::scalar:
+        break;
+    }
+#endif
+  }
+  std::fill_n(a, n, value);
+}
+
+template <class T>
+bool equal(const T *a, const T *b, size_type n) {
+  return mismatch(a, b, n) == n;
+}
+
+// Lexicographic a < b with the element order of operator<. Elements that
+// are neither smaller nor greater, such as a NaN, are skipped like equal
+// ones.
+template <class T>
+bool lexicographical_compare(const T *a, size_type a_size, const T *b,
+                             size_type b_size) {
+  size_type n = std::min(a_size, b_size);
+  for (size_type i = mismatch(a, b, n); i < n;
+       i += 1 + mismatch(a + i + 1, b + i + 1, n - i - 1)) {
+    if (a[i] < b[i]) return true;
+    if (b[i] < a[i]) return false;
+  }
+  return a_size < b_size;
+}
+
+}  // namespace simd
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_SIMD_H
@@ -0,0 +1,225 @@
+#ifndef S21_CONTAINERS_SRC_S21_SMALL_VECTOR_H
+#define S21_CONTAINERS_SRC_S21_SMALL_VECTOR_H
+
+#include "s21_vector.h"
+
+namespace s21 {
+// Vector keeping up to N elements inline in the object and spilling to the
+// heap beyond that, so short vectors never allocate. Once spilled it grows
+// like s21::vector with the same Growth policy; shrink_to_fit() moves the
+// elements back inline when they fit. Moving or swapping an inline vector
+// moves its elements one by one, so both are O(N) rather than O(1). Heap
+// storage comes from Allocator.
+template <class T, size_type N, class Allocator = std::allocator<T>,
+          class Growth = pow2_growth>
+class small_vector
+    : public vector_base<small_vector<T, N, Allocator, Growth>, T, Allocator,
+                         Growth> {
+  using base = vector_base<small_vector, T, Allocator, Growth>;
+  using typename base::alloc_traits;
+  using base::alloc;
+  using base::capacity_;
+  using base::container_;
+  using base::size_;
+  friend base;
+
+  static_assert(N > 0, "small_vector needs room for at least one element");
+
+ public:
+  using typename base::allocator_type;
+  using typename base::const_pointer;
+  using typename base::const_reference;
+  using typename base::pointer;
+  using typename base::value_type;
+
+  static constexpr size_type inline_capacity = N;
+
+  small_vector() noexcept { reset(); }
+
+  explicit small_vector(const allocator_type &alloc) noexcept : base(alloc) {
+    reset();
+  }
+
+  explicit small_vector(size_type count, const_reference value,
+                        const allocator_type &alloc = allocator_type())
+      : small_vector(alloc) {
+    reserve(count);
+    base::fill_raw(container_, count, value);
+    size_ = count;
+  }
+
+  explicit small_vector(size_type count,
+                        const allocator_type &alloc = allocator_type())
+      : small_vector(alloc) {
+    reserve(count);
+    std::uninitialized_value_construct_n(container_, count);
+    size_ = count;
+  }
+
+  small_vector(const small_vector &other)
+      : small_vector(other,
+                     alloc_traits::select_on_container_copy_construction(
+                         other.alloc())) {}
+
+  small_vector(const small_vector &other, const allocator_type &alloc)
+      : small_vector(alloc) {
+    reserve(other.size_);
+    std::uninitialized_copy_n(other.container_, other.size_, container_);
+    size_ = other.size_;
+  }
+
+  small_vector(small_vector &&other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>)
+      : small_vector(std::move(other.alloc())) {
+    take(other);
+  }
+
+  small_vector(std::initializer_list<value_type> ilist,
+               const allocator_type &alloc = allocator_type())
+      : small_vector(alloc) {
+    this->append(ilist.begin(), ilist.end());
+  }
+
+  ~small_vector() {
+    this->clear();
+    deallocate();
+  }
+
+  small_vector &operator=(const small_vector &other) {
+    if (this != &other) {
+      this->clear();
+      if (alloc_traits::propagate_on_container_copy_assignment::value &&
+          !this->same_alloc(other.alloc())) {
+        deallocate();
+        reset();
+      }
+      this->copy_alloc(other.alloc());
+      reserve(other.size_);
+      std::uninitialized_copy_n(other.container_, other.size_, container_);
+      size_ = other.size_;
+    }
+    return *this;
+  }
+
+  small_vector &operator=(small_vector &&other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) {
+    if (this != &other) {
+      this->clear();
+      if (alloc_traits::propagate_on_container_move_assignment::value ||
+          this->same_alloc(other.alloc())) {
+        deallocate();
+        reset();
+        this->move_alloc(other.alloc());
+        take(other);
+      } else {
+        this->append(std::make_move_iterator(other.begin()),
+                     std::make_move_iterator(other.end()));
+        other.clear();
+      }
+    }
+    return *this;
+  }
+
+  small_vector &operator=(std::initializer_list<T> ilist) {
+    this->clear();
+    this->append(ilist.begin(), ilist.end());
+    return *this;
+  }
+
+  void assign(size_type count, const_reference value) {
+    const value_type copy(value);
+    this->clear();
+    this->insert(this->cend(), count, copy);
+  }
+
+  void assign(std::initializer_list<T> ilist) { *this = ilist; }
+
+  size_type max_size() const noexcept {
+    return std::min<size_type>(
+        std::numeric_limits<size_type>::max() / sizeof(value_type),
+        alloc_traits::max_size(alloc()));
+  }
+
+  // True while the elements live in the object itself.
+  bool is_inline() const noexcept { return container_ == inline_data(); }
+
+  void reserve(size_type new_cap) {
+    if (new_cap > capacity_) {
+      this->reallocate(this->fit_capacity(new_cap));
+    }
+  }
+
+  // Moves the elements back inline if they fit, otherwise reallocates to
+  // exactly size() slots.
+  void shrink_to_fit() {
+    if (is_inline() || size_ == capacity_) return;
+    if (size_ <= N) {
+      this->adopt(inline_data(), N);
+    } else {
+      this->reallocate(size_);
+    }
+  }
+
+  // Heap buffers are exchanged together with the allocators if those
+  // propagate on swap; inline elements are moved, with the allocators
+  // following the move assignment rules. As for vector, allocators that do
+  // not propagate must compare equal, so no storage is allocated.
+  void swap(small_vector &other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) {
+    if (!is_inline() && !other.is_inline()) {
+      this->swap_alloc(other.alloc());
+      std::swap(size_, other.size_);
+      std::swap(capacity_, other.capacity_);
+      std::swap(container_, other.container_);
+    } else if (this != &other) {
+      small_vector tmp(std::move(other));
+      other = std::move(*this);
+      *this = std::move(tmp);
+    }
+  }
+
+ private:
+  pointer inline_data() noexcept {
+    return reinterpret_cast<pointer>(buffer_);
+  }
+
+  const_pointer inline_data() const noexcept {
+    return reinterpret_cast<const_pointer>(buffer_);
+  }
+
+  void reset() noexcept {
+    size_ = 0;
+    capacity_ = N;
+    container_ = inline_data();
+  }
+
+  using base::deallocate;
+
+  // Frees heap storage; the elements must have been destroyed.
+  void deallocate() noexcept {
+    if (!is_inline()) alloc_traits::deallocate(alloc(), container_, capacity_);
+  }
+
+  // Takes the elements of other, leaving it empty and inline. Heap storage
+  // changes hands, inline elements are relocated into this vector, which
+  // must be empty.
+  void take(small_vector &other) {
+    if (other.is_inline()) {
+      relocate(other.container_, other.container_ + other.size_, container_);
+      size_ = other.size_;
+      other.size_ = 0;
+    } else {
+      deallocate();
+      size_ = other.size_;
+      capacity_ = other.capacity_;
+      container_ = other.container_;
+      other.reset();
+    }
+  }
+
+  alignas(value_type) unsigned char buffer_[N * sizeof(value_type)];
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_SMALL_VECTOR_H
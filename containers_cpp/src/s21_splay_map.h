@@ -0,0 +1,48 @@
+#ifndef S21_CONTAINERS_SRC_S21_SPLAY_MAP_H
+#define S21_CONTAINERS_SRC_S21_SPLAY_MAP_H
+
+#include "s21_map.h"
+
+namespace s21 {
+// map whose tree moves inserted and looked up keys to the root, for skewed
+// access patterns where a few hot keys dominate the lookups. Only lookups
+// through a non-const map splay: they modify the tree and need the same
+// synchronization as inserts. Const lookups leave the tree as it is.
+template <class Key, class T, class Compare = std::less<Key>,
+          class Allocator = std::allocator<std::pair<const Key, T>>>
+class splay_map : public s21::map<Key, T, Compare, Allocator, splay_balance> {
+  using key_type = Key;
+  using base = s21::map<key_type, T, Compare, Allocator, splay_balance>;
+  using pair_type = typename base::pair_type;
+
+ public:
+  splay_map() : base() {}
+
+  explicit splay_map(const Allocator& alloc) : base(alloc) {}
+
+  splay_map(const splay_map& other) : base(other) {}
+
+  splay_map(splay_map&& other) noexcept : base(std::move(other)) {}
+
+  splay_map(std::initializer_list<pair_type> const& items) { *this = items; }
+
+  splay_map& operator=(const splay_map& other) {
+    base::operator=(other);
+    return *this;
+  }
+
+  splay_map& operator=(splay_map&& other) noexcept {
+    base::operator=(std::move(other));
+    return *this;
+  }
+
+  splay_map& operator=(std::initializer_list<pair_type> ilist) {
+    for (auto it = ilist.begin(); it != ilist.end(); ++it) {
+      this->insert(*it);
+    }
+    return *this;
+  }
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_SPLAY_MAP_H
@@ -0,0 +1,47 @@
+#ifndef S21_CONTAINERS_SRC_S21_SPLAY_SET_H
+#define S21_CONTAINERS_SRC_S21_SPLAY_SET_H
+
+#include "s21_set.h"
+
+namespace s21 {
+// set whose tree moves inserted and looked up keys to the root, for skewed
+// access patterns where a few hot keys dominate the lookups. Only lookups
+// through a non-const set splay: they modify the tree and need the same
+// synchronization as inserts. Const lookups leave the tree as it is.
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Key>>
+class splay_set : public s21::set<Key, Compare, Allocator, splay_balance> {
+  using key_type = Key;
+  using base = s21::set<key_type, Compare, Allocator, splay_balance>;
+
+ public:
+  splay_set() : base() {}
+
+  explicit splay_set(const Allocator& alloc) : base(alloc) {}
+
+  splay_set(const splay_set& other) : base(other) {}
+
+  splay_set(splay_set&& other) noexcept : base(std::move(other)) {}
+
+  splay_set(std::initializer_list<key_type> init) { *this = init; }
+
+  splay_set& operator=(const splay_set& other) {
+    base::operator=(other);
+    return *this;
+  }
+
+  splay_set& operator=(splay_set&& other) noexcept {
+    base::operator=(std::move(other));
+    return *this;
+  }
+
+  splay_set& operator=(std::initializer_list<key_type> ilist) {
+    for (auto it = ilist.begin(); it != ilist.end(); ++it) {
+      this->insert(*it);
+    }
+    return *this;
+  }
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_SPLAY_SET_H
@@ -3,7 +3,9 @@
 
 #include <exception>
 #include <iostream>
+#include <memory>
 #include <string>
+#include <type_traits>
 
 #include "s21_vector.h"
 
@@ -21,6 +23,16 @@ class stack {
 
   explicit stack(const container_type &cont) : c_(cont) {}
 
+  // The allocator is chosen through Container; these hand one to it.
+  template <class Alloc, class = std::enable_if_t<
+                             std::uses_allocator_v<container_type, Alloc>>>
+  explicit stack(const Alloc &alloc) : c_(alloc) {}
+
+  template <class Alloc, class = std::enable_if_t<
+                             std::uses_allocator_v<container_type, Alloc>>>
+  stack(std::initializer_list<value_type> const &items, const Alloc &alloc)
+      : c_(items, alloc) {}
+
   stack(const stack &other) { *this = other; }
 
   stack(stack &&other) { *this = std::move(other); }
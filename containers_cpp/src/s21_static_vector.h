@@ -0,0 +1,430 @@
+#ifndef S21_CONTAINERS_SRC_S21_STATIC_VECTOR_H
+#define S21_CONTAINERS_SRC_S21_STATIC_VECTOR_H
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+namespace {
+// Storage of static_vector. Trivial element types are kept in a plain array
+// so the whole container stays a literal type, usable in constexpr code, and
+// is copied as a block; others get raw storage of which only the first size
+// slots hold live objects.
+template <class T, size_type N, bool = std::is_trivial_v<T>>
+struct StaticVectorStorage {
+  constexpr T *data() noexcept { return elems; }
+  constexpr const T *data() const noexcept { return elems; }
+
+  size_type size = 0;
+  T elems[N] = {};
+};
+
+template <class T, size_type N>
+struct StaticVectorStorage<T, N, false> {
+  StaticVectorStorage() noexcept {}
+
+  StaticVectorStorage(const StaticVectorStorage &other) {
+    std::uninitialized_copy_n(other.data(), other.size, data());
+    size = other.size;
+  }
+
+  StaticVectorStorage(StaticVectorStorage &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T>) {
+    std::uninitialized_move_n(other.data(), other.size, data());
+    size = other.size;
+  }
+
+  StaticVectorStorage &operator=(const StaticVectorStorage &other) {
+    if (this != &other) assign(other.data(), other.size);
+    return *this;
+  }
+
+  StaticVectorStorage &operator=(StaticVectorStorage &&other) noexcept(
+      std::is_nothrow_move_assignable_v<T> &&
+      std::is_nothrow_move_constructible_v<T>) {
+    if (this != &other) {
+      assign(std::make_move_iterator(other.data()), other.size);
+    }
+    return *this;
+  }
+
+  ~StaticVectorStorage() { std::destroy_n(data(), size); }
+
+  T *data() noexcept { return reinterpret_cast<T *>(buffer); }
+  const T *data() const noexcept {
+    return reinterpret_cast<const T *>(buffer);
+  }
+
+  // Assigns over the live prefix and constructs or destroys the rest.
+  template <class It>
+  void assign(It first, size_type count) {
+    size_type common = std::min(size, count);
+    for (size_type i = 0; i < common; i++, ++first) data()[i] = *first;
+    if (count > size) {
+      std::uninitialized_copy_n(first, count - size, data() + size);
+    } else {
+      std::destroy(data() + count, data() + size);
+    }
+    size = count;
+  }
+
+  size_type size = 0;
+  alignas(T) unsigned char buffer[N * sizeof(T)];
+};
+}  // namespace
+
+// Vector with a fixed capacity of N elements stored inline: it never touches
+// the heap, and an operation that would exceed N throws std::length_error
+// before changing the vector (single-pass ranges excepted, see insert). For
+// trivial element types every member is constexpr. Iterators are plain
+// pointers.
+template <class T, size_type N>
+class static_vector {
+  static_assert(N > 0, "static_vector needs room for at least one element");
+  static constexpr bool kTrivial = std::is_trivial_v<T>;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using iterator = pointer;
+  using const_iterator = const_pointer;
+
+ public:
+  constexpr static_vector() noexcept {}
+
+  constexpr explicit static_vector(size_type count, const_reference value) {
+    insert(cend(), count, value);
+  }
+
+  constexpr explicit static_vector(size_type count) { resize(count); }
+
+  constexpr static_vector(std::initializer_list<value_type> ilist) {
+    append(ilist.begin(), ilist.end());
+  }
+
+  constexpr static_vector &operator=(std::initializer_list<T> ilist) {
+    check_room(0, ilist.size());
+    clear();
+    append(ilist.begin(), ilist.end());
+    return *this;
+  }
+
+  constexpr void assign(size_type count, const_reference value) {
+    check_room(0, count);
+    const value_type copy(value);
+    clear();
+    insert(cend(), count, copy);
+  }
+
+  constexpr void assign(std::initializer_list<T> ilist) { *this = ilist; }
+
+  constexpr reference at(size_type pos) {
+    if (pos >= size()) {
+      throw std::out_of_range("Index out of range");
+    }
+    return operator[](pos);
+  }
+
+  constexpr const_reference at(size_type pos) const {
+    if (pos >= size()) {
+      throw std::out_of_range("Index out of range");
+    }
+    return operator[](pos);
+  }
+
+  constexpr reference operator[](size_type pos) { return data()[pos]; }
+
+  constexpr const_reference operator[](size_type pos) const {
+    return data()[pos];
+  }
+
+  constexpr reference front() { return operator[](0); }
+
+  constexpr const_reference front() const { return operator[](0); }
+
+  constexpr reference back() { return operator[](size() - 1); }
+
+  constexpr const_reference back() const { return operator[](size() - 1); }
+
+  constexpr pointer data() noexcept { return storage_.data(); }
+
+  constexpr const_pointer data() const noexcept { return storage_.data(); }
+
+  constexpr iterator begin() noexcept { return data(); }
+
+  constexpr const_iterator begin() const noexcept { return data(); }
+
+  constexpr const_iterator cbegin() const noexcept { return data(); }
+
+  constexpr iterator end() noexcept { return data() + size(); }
+
+  constexpr const_iterator end() const noexcept { return data() + size(); }
+
+  constexpr const_iterator cend() const noexcept { return data() + size(); }
+
+  constexpr bool empty() const noexcept { return !size(); }
+
+  constexpr bool full() const noexcept { return size() == N; }
+
+  constexpr size_type size() const noexcept { return storage_.size; }
+
+  static constexpr size_type max_size() noexcept { return N; }
+
+  static constexpr size_type capacity() noexcept { return N; }
+
+  // Only checks that new_cap fits, the storage is always there.
+  constexpr void reserve(size_type new_cap) const { check_room(0, new_cap); }
+
+  constexpr void clear() noexcept { destroy_tail(0); }
+
+  constexpr iterator insert(const_iterator pos, const T &value) {
+    return emplace(pos, value);
+  }
+
+  constexpr iterator insert(const_iterator pos, T &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  constexpr iterator insert(const_iterator pos, size_type count,
+                            const T &value) {
+    size_type position = pos - cbegin();
+    check_room(size(), count);
+    const value_type copy(value);
+    size_type live = open_gap(position, count);
+    for (size_type i = 0; i < count; i++) {
+      put(position + i, i < live, copy);
+    }
+    storage_.size += count;
+    return begin() + position;
+  }
+
+  // Inserts [first, last), which must not point into this vector. A
+  // single-pass range cannot be measured up front: if it overflows, the
+  // elements that fit stay appended at the end and the call throws.
+  template <class InputIt,
+            class = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  constexpr iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type position = pos - cbegin();
+    if constexpr (is_forward_iterator<InputIt>::value) {
+      size_type count = std::distance(first, last);
+      check_room(size(), count);
+      size_type live = open_gap(position, count);
+      for (size_type i = 0; i < count; i++, ++first) {
+        put(position + i, i < live, *first);
+      }
+      storage_.size += count;
+    } else {
+      size_type old_size = size();
+      append(first, last);
+      std::rotate(begin() + position, begin() + old_size, end());
+    }
+    return begin() + position;
+  }
+
+  constexpr iterator insert(const_iterator pos,
+                            std::initializer_list<T> ilist) {
+    return insert(pos, ilist.begin(), ilist.end());
+  }
+
+  template <class InputIt>
+  constexpr void append(InputIt first, InputIt last) {
+    if constexpr (is_forward_iterator<InputIt>::value) {
+      insert(cend(), first, last);
+    } else {
+      for (; first != last; ++first) emplace_back(*first);
+    }
+  }
+
+  template <class... Args>
+  constexpr iterator insert_many(const_iterator pos, Args &&... args) {
+    std::initializer_list<value_type> ilist = {std::forward<Args>(args)...};
+    return insert(pos, ilist.begin(), ilist.end());
+  }
+
+  template <class... Args>
+  constexpr void insert_many_back(Args &&... args) {
+    std::initializer_list<value_type> ilist = {std::forward<Args>(args)...};
+    append(ilist.begin(), ilist.end());
+  }
+
+  template <class... Args>
+  constexpr iterator emplace(const_iterator pos, Args &&... args) {
+    size_type position = pos - cbegin();
+    check_room(size(), 1);
+    if (position == size()) {
+      construct(position, std::forward<Args>(args)...);
+    } else {
+      value_type value(std::forward<Args>(args)...);
+      open_gap(position, 1);
+      data()[position] = std::move(value);
+    }
+    storage_.size++;
+    return begin() + position;
+  }
+
+  template <class... Args>
+  constexpr reference emplace_back(Args &&... args) {
+    check_room(size(), 1);
+    construct(size(), std::forward<Args>(args)...);
+    storage_.size++;
+    return back();
+  }
+
+  constexpr void push_back(const T &value) { emplace_back(value); }
+
+  constexpr void push_back(T &&value) { emplace_back(std::move(value)); }
+
+  constexpr void pop_back() { destroy_tail(size() - 1); }
+
+  constexpr iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+  constexpr iterator erase(const_iterator first, const_iterator last) {
+    size_type position = first - cbegin();
+    size_type diff = last - first;
+    if (diff) {
+      for (size_type i = position + diff; i < size(); i++) {
+        data()[i - diff] = std::move(data()[i]);
+      }
+      destroy_tail(size() - diff);
+    }
+    return begin() + position;
+  }
+
+  constexpr void resize(size_type count) {
+    check_room(0, count);
+    while (size() < count) emplace_back();
+    destroy_tail(count);
+  }
+
+  constexpr void resize(size_type count, const value_type &value) {
+    check_room(0, count);
+    if (count > size()) insert(cend(), count - size(), value);
+    destroy_tail(count);
+  }
+
+  constexpr void swap(static_vector &other) {
+    static_vector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+ private:
+  constexpr void check_room(size_type size, size_type count) const {
+    if (count > N - size) {
+      throw std::length_error("static_vector capacity exceeded");
+    }
+  }
+
+  template <class... Args>
+  constexpr void construct(size_type pos, Args &&... args) {
+    if constexpr (kTrivial) {
+      if constexpr (std::is_constructible_v<value_type, Args...>) {
+        data()[pos] = value_type(std::forward<Args>(args)...);
+      } else {
+        data()[pos] = value_type{std::forward<Args>(args)...};
+      }
+    } else {
+      ::new (static_cast<void *>(data() + pos))
+          value_type(std::forward<Args>(args)...);
+    }
+  }
+
+  // Writes value into slot pos, which holds a live element or raw storage.
+  template <class U>
+  constexpr void put(size_type pos, bool live, U &&value) {
+    if (live) {
+      data()[pos] = std::forward<U>(value);
+    } else {
+      construct(pos, std::forward<U>(value));
+    }
+  }
+
+  // Destroys the elements from count on.
+  constexpr void destroy_tail(size_type count) noexcept {
+    if constexpr (!kTrivial) {
+      std::destroy(data() + count, data() + size());
+    }
+    if (count < size()) storage_.size = count;
+  }
+
+  // Shifts [position, size()) right by count slots, which must fit, leaving
+  // size() unchanged. Returns how many slots of the gap still hold live
+  // (moved-from) elements; the rest are raw storage. An empty gap moves
+  // nothing, since shifting by zero would move each element onto itself.
+  constexpr size_type open_gap(size_type position, size_type count) {
+    if (count == 0) return 0;
+    for (size_type i = size(); i-- > position;) {
+      put(i + count, i + count < size(), std::move(data()[i]));
+    }
+    return std::min(count, size() - position);
+  }
+
+  StaticVectorStorage<T, N> storage_;
+};
+
+template <class T, size_type N>
+constexpr bool operator==(const static_vector<T, N> &lhs,
+                          const static_vector<T, N> &rhs) {
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+  for (size_type i = 0; i < lhs.size(); i++) {
+    if (!(lhs[i] == rhs[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class T, size_type N>
+constexpr bool operator!=(const static_vector<T, N> &lhs,
+                          const static_vector<T, N> &rhs) {
+  return !(lhs == rhs);
+}
+
+template <class T, size_type N>
+constexpr bool operator<(const static_vector<T, N> &lhs,
+                         const static_vector<T, N> &rhs) {
+  size_type min_size = std::min(lhs.size(), rhs.size());
+  for (size_type i = 0; i < min_size; i++) {
+    if (lhs[i] < rhs[i]) {
+      return true;
+    } else if (rhs[i] < lhs[i]) {
+      return false;
+    }
+  }
+  return lhs.size() < rhs.size();
+}
+
+template <class T, size_type N>
+constexpr bool operator<=(const static_vector<T, N> &lhs,
+                          const static_vector<T, N> &rhs) {
+  return !(rhs < lhs);
+}
+
+template <class T, size_type N>
+constexpr bool operator>(const static_vector<T, N> &lhs,
+                         const static_vector<T, N> &rhs) {
+  return rhs < lhs;
+}
+
+template <class T, size_type N>
+constexpr bool operator>=(const static_vector<T, N> &lhs,
+                          const static_vector<T, N> &rhs) {
+  return !(lhs < rhs);
+}
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_STATIC_VECTOR_H
@@ -0,0 +1,271 @@
+#ifndef S21_CONTAINERS_SRC_S21_TREE_BALANCE_H_
+#define S21_CONTAINERS_SRC_S21_TREE_BALANCE_H_
+
+namespace s21 {
+enum Color { BLACK, RED };
+
+// Balancing policies for s21::tree. A policy is a friend of the tree and
+// provides three hooks:
+//   after_insert(tree, node) - node has just been linked in as a leaf;
+//   erase(tree, node)        - unlink node, free it and restore the balance;
+//   after_find(tree, node, depth) - node was found depth levels below the
+//                                   root by a lookup on a non-const tree.
+
+// Red-black tree: at most 2 log(n) deep, at most three rotations per update.
+struct rb_balance {
+  template <class Tree>
+  static void after_insert(Tree &tree, typename Tree::node_type *node) {
+    auto *curr = node->parent;
+    while (curr != nullptr && curr->color == RED && curr->parent != nullptr) {
+      auto *grand = curr->parent;
+      bool is_right = (curr == grand->right);
+      auto *uncle = is_right ? grand->left : grand->right;
+
+      if (uncle != nullptr && uncle->color == RED) {
+        curr->color = BLACK;
+        uncle->color = BLACK;
+        grand->color = RED;
+        node = grand;
+        curr = node->parent;
+      } else {
+        if ((is_right && node == curr->left) ||
+            (!is_right && node == curr->right)) {
+          is_right ? tree.right_rotate(curr) : tree.left_rotate(curr);
+          curr = node;
+        }
+        curr->color = BLACK;
+        grand->color = RED;
+        is_right ? tree.left_rotate(grand) : tree.right_rotate(grand);
+        break;
+      }
+    }
+    tree.root_->color = BLACK;
+  }
+
+  template <class Tree>
+  static void erase(Tree &tree, typename Tree::node_type *node) {
+    if (node->left == nullptr && node->right == nullptr) {
+      if (node->color == BLACK) rebalance_after_extract(tree, node);
+      tree.unlink_node(node);
+    } else {
+      typename Tree::node_type *node_to_swap = nullptr;
+      if (node->left != nullptr && node->right != nullptr)
+        node_to_swap = get_node_to_swap(node);
+      else
+        node_to_swap = (node->left == nullptr) ? node->right : node->left;
+      node->key = node_to_swap->key;
+      node->value = node_to_swap->value;
+      erase(tree, node_to_swap);
+    }
+  }
+
+  template <class Tree>
+  static void after_find(const Tree &, typename Tree::node_type *, int) {}
+
+ private:
+  template <class Node>
+  static Node *get_node_to_swap(const Node *node) {
+    Node *max_left = node->left;
+    Node *min_right = node->right;
+    int left_count = 0, right_count = 0;
+    auto *curr = max_left;
+    while (curr->right != nullptr) {
+      max_left = curr->right;
+      left_count++;
+      curr = curr->right;
+    }
+    curr = min_right;
+    while (curr->left != nullptr) {
+      min_right = curr->left;
+      right_count++;
+      curr = curr->left;
+    }
+    return (left_count >= right_count) ? max_left : min_right;
+  }
+
+  template <class Tree>
+  static void rebalance_after_extract(Tree &tree,
+                                      typename Tree::node_type *node) {
+    if (node == tree.root_) return;
+    auto *parent = node->parent;
+    bool is_left = (node == parent->left);
+    auto *sibling = is_left ? parent->right : parent->left;
+
+    if (sibling->color == BLACK) {
+      if ((sibling->left != nullptr && sibling->left->color == RED) ||
+          (sibling->right != nullptr && sibling->right->color == RED)) {
+        rebalance_when_one_child_is_red(tree, parent, is_left);
+      } else {
+        int parent_color = parent->color;
+        sibling->color = RED;
+        parent->color = BLACK;
+        if (parent_color == BLACK) rebalance_after_extract(tree, parent);
+      }
+    } else {
+      parent->color = RED;
+      sibling->color = BLACK;
+      is_left ? tree.left_rotate(parent) : tree.right_rotate(parent);
+      rebalance_after_extract(tree, node);
+    }
+  }
+
+  template <class Tree>
+  static void rebalance_when_one_child_is_red(Tree &tree,
+                                              typename Tree::node_type *parent,
+                                              bool is_left) {
+    auto *sibling = is_left ? parent->right : parent->left;
+    if ((is_left && sibling->right != nullptr &&
+         sibling->right->color == RED) ||
+        (!is_left && sibling->left != nullptr && sibling->left->color == RED)) {
+      sibling->color = parent->color;
+      parent->color = BLACK;
+      is_left ? sibling->right->color = BLACK : sibling->left->color = BLACK;
+      is_left ? tree.left_rotate(parent) : tree.right_rotate(parent);
+    } else {
+      is_left ? sibling->left->color = BLACK : sibling->right->color = BLACK;
+      sibling->color = RED;
+      is_left ? tree.right_rotate(sibling) : tree.left_rotate(sibling);
+      rebalance_when_one_child_is_red(tree, parent, is_left);
+    }
+  }
+};
+
+// AVL tree: subtree heights differ by at most one, so the tree is at most
+// 1.44 log(n) deep, which favours lookups over cheap updates. Only trees
+// with this policy store the height in their nodes (AvlNode).
+struct avl_balance {
+  template <class Tree>
+  static void after_insert(Tree &tree, typename Tree::node_type *node) {
+    retrace(tree, node->parent);
+  }
+
+  template <class Tree>
+  static void erase(Tree &tree, typename Tree::node_type *node) {
+    retrace(tree, tree.unlink_node(node));
+  }
+
+  template <class Tree>
+  static void after_find(const Tree &, typename Tree::node_type *, int) {}
+
+ private:
+  template <class Tree>
+  static int &height_of(typename Tree::node_type *node) {
+    return static_cast<typename Tree::stored_node *>(node)->height;
+  }
+
+  template <class Tree>
+  static int height(typename Tree::node_type *node) {
+    return node ? height_of<Tree>(node) : 0;
+  }
+
+  template <class Tree>
+  static void update_height(typename Tree::node_type *node) {
+    int left = height<Tree>(node->left);
+    int right = height<Tree>(node->right);
+    height_of<Tree>(node) = 1 + (left > right ? left : right);
+  }
+
+  template <class Tree>
+  static void rotate_left(Tree &tree, typename Tree::node_type *node) {
+    tree.left_rotate(node);
+    update_height<Tree>(node);
+    update_height<Tree>(node->parent);
+  }
+
+  template <class Tree>
+  static void rotate_right(Tree &tree, typename Tree::node_type *node) {
+    tree.right_rotate(node);
+    update_height<Tree>(node);
+    update_height<Tree>(node->parent);
+  }
+
+  // Walks up from node fixing heights and rotating unbalanced subtrees, until
+  // a subtree ends up as high as it was before the update.
+  template <class Tree>
+  static void retrace(Tree &tree, typename Tree::node_type *node) {
+    while (node != nullptr) {
+      int old_height = height_of<Tree>(node);
+      update_height<Tree>(node);
+      int balance = height<Tree>(node->left) - height<Tree>(node->right);
+      if (balance > 1) {
+        if (height<Tree>(node->left->left) < height<Tree>(node->left->right))
+          rotate_left(tree, node->left);
+        rotate_right(tree, node);
+        node = node->parent;
+      } else if (balance < -1) {
+        if (height<Tree>(node->right->right) <
+            height<Tree>(node->right->left))
+          rotate_right(tree, node->right);
+        rotate_left(tree, node);
+        node = node->parent;
+      }
+      if (height_of<Tree>(node) == old_height) break;
+      node = node->parent;
+    }
+  }
+};
+
+// Self-adjusting (splay) tree: no balance is kept; inserted nodes and nodes
+// found deeper than kSplayDepth are moved to the root, so frequently accessed
+// keys stay a few levels deep. Only lookups on a non-const tree splay.
+struct splay_balance {
+  // Lookups that end this close to the root leave the tree as it is: the
+  // key is already cheap to reach and rotations would only cost writes.
+  static constexpr int kSplayDepth = 8;
+
+  template <class Tree>
+  static void after_insert(Tree &tree, typename Tree::node_type *node) {
+    splay(tree, node);
+  }
+
+  template <class Tree>
+  static void erase(Tree &tree, typename Tree::node_type *node) {
+    tree.unlink_node(node);
+  }
+
+  template <class Tree>
+  static void after_find(Tree &tree, typename Tree::node_type *node,
+                         int depth) {
+    if (depth > kSplayDepth) splay(tree, node);
+  }
+
+ private:
+  template <class Tree>
+  static void splay(Tree &tree, typename Tree::node_type *node) {
+    while (node->parent) {
+      auto *parent = node->parent;
+      auto *grand = parent->parent;
+      if (grand == nullptr) {
+        tree.rotate_up(node);
+      } else if ((grand->left == parent) == (parent->left == node)) {
+        tree.rotate_up(parent);
+        tree.rotate_up(node);
+      } else {
+        tree.rotate_up(node);
+        tree.rotate_up(node);
+      }
+    }
+  }
+};
+
+// Balances like Balance and gives every node a subtree hash, so that the
+// tree supports the Merkle augmentation (tree::enable_merkle()). Trees with
+// a plain policy allocate nodes without the hash.
+template <class Balance = rb_balance>
+struct merkle {};
+
+template <class Balance>
+struct balance_traits {
+  using policy = Balance;
+  static constexpr bool is_merkle = false;
+};
+
+template <class Balance>
+struct balance_traits<merkle<Balance>> {
+  using policy = Balance;
+  static constexpr bool is_merkle = true;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_TREE_BALANCE_H_
@@ -0,0 +1,195 @@
+#ifndef S21_CONTAINERS_SRC_S21_TTL_MAP_H
+#define S21_CONTAINERS_SRC_S21_TTL_MAP_H
+
+#include <chrono>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_rbtree.h"
+
+namespace s21 {
+// Map whose entries expire a given time after they were written. Besides
+// the tree of entries it keeps a second tree ordered by (deadline, key), so
+// expire(now) walks exactly the expired entries, O(k log n) for k of them,
+// instead of sweeping the whole map. An entry is expired once now reaches
+// its deadline; lookups skip expired entries even before expire() has
+// removed them, and size() counts entries until they are removed. The
+// nodes of both trees come from Allocator.
+template <class K, class V,
+          class Allocator = std::allocator<std::pair<const K, V>>,
+          class Clock = std::chrono::steady_clock>
+class ttl_map {
+ public:
+  using key_type = K;
+  using value_type = V;
+  using size_type = std::size_t;
+  using allocator_type = Allocator;
+  using clock_type = Clock;
+  using time_point = typename Clock::time_point;
+  using duration = typename Clock::duration;
+
+  ttl_map() {}
+
+  explicit ttl_map(const allocator_type &alloc)
+      : entries_(alloc), deadlines_(alloc) {}
+
+  bool empty() const noexcept { return entries_.empty(); }
+
+  size_type size() const noexcept { return entries_.size(); }
+
+  // Inserts key unless a live entry already holds it; an expired entry is
+  // replaced.
+  bool insert(const key_type &key, const value_type &value, duration ttl,
+              time_point now = Clock::now()) {
+    entry *found = find_entry(key);
+    if (found != nullptr && now < found->deadline) return false;
+    write(found, key, value, now + ttl);
+    return true;
+  }
+
+  // Returns true if the key was inserted, false if a live value was
+  // replaced. Either way the entry lives for ttl from now.
+  bool insert_or_assign(const key_type &key, const value_type &value,
+                        duration ttl, time_point now = Clock::now()) {
+    entry *found = find_entry(key);
+    bool inserted = found == nullptr || !(now < found->deadline);
+    write(found, key, value, now + ttl);
+    return inserted;
+  }
+
+  // Value of a live entry, or nullptr.
+  value_type *find(const key_type &key, time_point now = Clock::now()) {
+    entry *found = find_entry(key);
+    return found != nullptr && now < found->deadline ? &found->value
+                                                     : nullptr;
+  }
+
+  const value_type *find(const key_type &key,
+                         time_point now = Clock::now()) const {
+    return const_cast<ttl_map *>(this)->find(key, now);
+  }
+
+  const value_type &at(const key_type &key,
+                       time_point now = Clock::now()) const {
+    const value_type *value = find(key, now);
+    if (value == nullptr) {
+      throw std::out_of_range("Key doesn't exist");
+    }
+    return *value;
+  }
+
+  bool contains(const key_type &key, time_point now = Clock::now()) const {
+    return find(key, now) != nullptr;
+  }
+
+  // Gives a live entry another ttl from now.
+  bool touch(const key_type &key, duration ttl,
+             time_point now = Clock::now()) {
+    entry *found = find_entry(key);
+    if (found == nullptr || !(now < found->deadline)) return false;
+    reschedule(key, *found, now + ttl);
+    return true;
+  }
+
+  // Deadline of the entry of key, expired or not.
+  time_point expires_at(const key_type &key) const {
+    entry *found = find_entry(key);
+    if (found == nullptr) {
+      throw std::out_of_range("Key doesn't exist");
+    }
+    return found->deadline;
+  }
+
+  bool erase(const key_type &key) {
+    entry *found = find_entry(key);
+    if (found == nullptr) return false;
+    deadlines_.erase(deadline_key(found->deadline, key));
+    entries_.erase(key);
+    return true;
+  }
+
+  void clear() noexcept {
+    entries_.clear();
+    deadlines_.clear();
+  }
+
+  void swap(ttl_map &other) {
+    entries_.swap(other.entries_);
+    deadlines_.swap(other.deadlines_);
+  }
+
+  allocator_type get_allocator() const noexcept {
+    return entries_.get_allocator();
+  }
+
+  // Removes the entries expired at now and returns their number.
+  size_type expire(time_point now = Clock::now()) {
+    size_type res = 0;
+    while (!deadlines_.empty()) {
+      deadline_key first = deadlines_.cbegin().get_key();
+      if (now < first.first) break;
+      deadlines_.erase(first);
+      entries_.erase(first.second);
+      res++;
+    }
+    return res;
+  }
+
+  // Earliest deadline, time_point::max() when the map is empty.
+  time_point next_expiry() const {
+    if (deadlines_.empty()) return time_point::max();
+    return deadlines_.cbegin().get_key().first;
+  }
+
+  // Calls fn(key, value) for every live entry in key order. If fn returns
+  // bool, false stops the walk.
+  template <class Fn>
+  void for_each(Fn fn, time_point now = Clock::now()) const {
+    entries_.for_each([&fn, now](const key_type &key, const entry &e) {
+      if (!(now < e.deadline)) return true;
+      if constexpr (std::is_same_v<decltype(fn(key, e.value)), bool>) {
+        return fn(key, e.value);
+      } else {
+        fn(key, e.value);
+        return true;
+      }
+    });
+  }
+
+ private:
+  struct entry {
+    value_type value;
+    time_point deadline;
+  };
+  using deadline_key = std::pair<time_point, key_type>;
+
+  entry *find_entry(const key_type &key) const {
+    auto it = entries_.find(key);
+    return it.get_pointer() ? &*it : nullptr;
+  }
+
+  void write(entry *found, const key_type &key, const value_type &value,
+             time_point deadline) {
+    if (found == nullptr) {
+      entries_.insert(key, entry{value, deadline});
+      deadlines_.insert(deadline_key(deadline, key), 0);
+    } else {
+      found->value = value;
+      reschedule(key, *found, deadline);
+    }
+  }
+
+  void reschedule(const key_type &key, entry &e, time_point deadline) {
+    if (e.deadline == deadline) return;
+    deadlines_.erase(deadline_key(e.deadline, key));
+    deadlines_.insert(deadline_key(deadline, key), 0);
+    e.deadline = deadline;
+  }
+
+  tree<key_type, entry, rb_balance, Allocator> entries_;
+  tree<deadline_key, char, rb_balance, Allocator> deadlines_;
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_TTL_MAP_H
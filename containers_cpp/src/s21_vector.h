@@ -2,9 +2,19 @@
 #define S21_CONTAINERS_SRC_S21_VECTOR_H
 
 #include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#include "s21_allocator.h"
+#include "s21_simd.h"
+
 namespace s21 {
 
 using size_type = std::size_t;
@@ -13,6 +23,7 @@ namespace {
 template <class T>
 class VectorConstIterator {
  public:
+  using iterator_category = std::random_access_iterator_tag;
   using value_type = const T;
   using reference = value_type &;
   using pointer = value_type *;
@@ -140,81 +151,188 @@ class VectorIterator : public VectorConstIterator<T> {
 
   explicit VectorIterator(pointer ptr) noexcept : base(ptr) {}
 };
-}  // namespace
 
-template <class T>
-class vector {
- public:
-  using value_type = T;
-  using reference = T &;
-  using const_reference = const T &;
-  using pointer = T *;
-  using const_pointer = const T *;
-  using iterator = VectorIterator<value_type>;
-  using const_iterator = VectorConstIterator<value_type>;
+// True for iterators that can be walked twice, so the length of a range can
+// be taken before it is copied.
+template <class It, class = void>
+struct is_forward_iterator : std::false_type {};
 
- public:
-  vector() { nullify(); }
+template <class It>
+struct is_forward_iterator<
+    It, std::void_t<typename std::iterator_traits<It>::iterator_category>>
+    : std::is_base_of<std::forward_iterator_tag,
+                      typename std::iterator_traits<It>::iterator_category> {
+};
 
-  explicit vector(size_type count, const_reference value) {
-    init(count);
-    std::fill(container_, container_ + count, value);
+// Moves or copies [first, last) into raw storage at out and destroys the
+// source. Trivially copyable elements go in one memcpy; others are moved
+// when that cannot throw (or is the only way) and copied otherwise, so a
+// throwing move never loses elements.
+template <class T>
+void relocate(T *first, T *last, T *out) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (first != last) {
+      std::memcpy(static_cast<void *>(out), first, (last - first) * sizeof(T));
+    }
+  } else {
+    if constexpr (std::is_nothrow_move_constructible_v<T> ||
+                  !std::is_copy_constructible_v<T>) {
+      std::uninitialized_move(first, last, out);
+    } else {
+      std::uninitialized_copy(first, last, out);
+    }
+    std::destroy(first, last);
   }
+}
 
-  explicit vector(size_type count) : vector(count, value_type()) {}
-
-  vector(const vector &v) {
-    init(v.size());
-    std::copy(v.container_, v.container_ + capacity_, container_);
+// Relocates [first, last) into raw storage at out, leaving gap free slots
+// after the elements before mid. Copies are used only under the same rule
+// as relocate(). If a copy throws, the copies already made are destroyed
+// and the source is left untouched.
+template <class T>
+void relocate_around(T *first, T *mid, T *last, T *out, size_type gap) {
+  T *tail = out + (mid - first) + gap;
+  if constexpr (std::is_trivially_copyable_v<T> ||
+                std::is_nothrow_move_constructible_v<T> ||
+                !std::is_copy_constructible_v<T>) {
+    relocate(first, mid, out);
+    relocate(mid, last, tail);
+  } else {
+    std::uninitialized_copy(first, mid, out);
+    try {
+      std::uninitialized_copy(mid, last, tail);
+    } catch (...) {
+      std::destroy(out, out + (mid - first));
+      throw;
+    }
+    std::destroy(first, last);
   }
+}
 
-  vector(vector &&v) {
-    size_ = capacity_ = v.size();
-    container_ = v.container_;
-    v.nullify();
+// Shifts the live range [gap, end) count slots to the right, into storage
+// that has room for them (a memmove for trivially copyable types). Returns
+// how many slots starting at gap still hold moved-from elements to be
+// assigned; the rest of the count slots are raw storage to construct into.
+template <class T>
+size_type shift_tail(T *gap, T *end, size_type count) {
+  size_type after = end - gap;
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (after) {
+      std::memmove(static_cast<void *>(gap + count), gap, after * sizeof(T));
+    }
+    return 0;
+  } else if (after > count) {
+    std::uninitialized_move(end - count, end, end);
+    std::move_backward(gap, end - count, end);
+    return count;
+  } else {
+    std::uninitialized_move(gap, end, gap + count);
+    return after;
   }
+}
 
-  vector(std::initializer_list<value_type> ilist) {
-    init(ilist.size());
-    std::copy(ilist.begin(), ilist.end(), container_);
+// Undoes shift_tail() after filling the gap failed: destroys the live slots
+// of the gap and moves the after elements behind it back to gap. If a move
+// throws, the elements not moved back yet are destroyed. Returns how many
+// elements now follow gap.
+template <class T>
+size_type unshift_tail(T *gap, size_type after, size_type count,
+                       size_type live) noexcept {
+  T *tail = gap + count;
+  std::destroy(gap, gap + live);
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (after) {
+      std::memmove(static_cast<void *>(gap), tail, after * sizeof(T));
+    }
+    return after;
+  } else {
+    size_type i = 0;
+    try {
+      for (; i < after; i++) {
+        ::new (static_cast<void *>(gap + i)) T(std::move(tail[i]));
+        std::destroy_at(tail + i);
+      }
+    } catch (...) {
+      std::destroy(tail + i, tail + after);
+    }
+    return i;
   }
+}
+}  // namespace
 
-  ~vector() { deallocate(); }
+// Growth policies of vector. grow(capacity, required) picks the capacity
+// when an insertion overflows the current one and must return at least
+// required; fit(count) is the capacity allocated for an explicit request
+// such as reserve() or construction. Capacity never shrinks on its own,
+// only shrink_to_fit() gives memory back.
 
-  vector &operator=(const vector &other) {
-    vector v(other);
-    swap(v);
-    return *this;
+// Doubles and rounds every capacity up to a power of two.
+struct pow2_growth {
+  static size_type fit(size_type count) noexcept {
+    size_type cap = 1;
+    while (cap < count) cap <<= 1;
+    return count ? cap : 0;
   }
 
-  vector &operator=(vector &&other) noexcept {
-    if (this != &other) {
-      swap(other);
-    }
-    return *this;
+  static size_type grow(size_type capacity, size_type required) noexcept {
+    return fit(std::max(required, capacity * 2));
   }
+};
 
-  vector &operator=(std::initializer_list<T> ilist) {
-    if (size_ != ilist.size()) {
-      delete[] container_;
-      init(ilist.size());
-    }
-    std::copy(ilist.begin(), ilist.end(), container_);
-    return *this;
+// Grows by half the current capacity, which lets a freed block be reused
+// by later growth and wastes at most a third of the storage.
+struct half_growth {
+  static size_type fit(size_type count) noexcept { return count; }
+
+  static size_type grow(size_type capacity, size_type required) noexcept {
+    return std::max(required, capacity + capacity / 2);
   }
+};
 
-  void assign(size_type count, const_reference value) {
-    *this = std::move(s21::vector(count, value));
+// Allocates exactly what is asked for. Appends become O(n) each, so this
+// is only for vectors sized up front.
+struct exact_growth {
+  static size_type fit(size_type count) noexcept { return count; }
+
+  static size_type grow(size_type, size_type required) noexcept {
+    return required;
   }
+};
 
-  void assign(std::initializer_list<T> ilist) { *this = ilist; }
+// Element management shared by vector and small_vector. Elements live in
+// raw storage: only [0, size()) is constructed, slots up to capacity() are
+// plain memory, so reserve() runs no constructors and the element type does
+// not need to be default constructible. Storage comes from Allocator;
+// elements are constructed in place without going through its construct()
+// and destroy(). Derived owns the storage and provides max_size() and
+// deallocate(), which releases the current storage.
+template <class Derived, class T, class Allocator, class Growth>
+class vector_base : protected allocator_holder<Allocator> {
+ protected:
+  using holder = allocator_holder<Allocator>;
+  using typename holder::alloc_traits;
+  using holder::alloc;
+
+  static_assert(std::is_same_v<typename alloc_traits::pointer, T *>,
+                "allocators with fancy pointers are not supported");
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using iterator = VectorIterator<value_type>;
+  using const_iterator = VectorConstIterator<value_type>;
+  using growth_policy = Growth;
 
   reference at(size_type pos) {
     if (pos >= size_) {
       throw std::out_of_range("Index out of range");
     }
     return operator[](pos);
-  };
+  }
 
   const_reference at(size_type pos) const {
     if (pos >= size_) {
@@ -255,177 +373,497 @@ class vector {
     return const_iterator(container_ + size_);
   }
 
-  bool empty() const noexcept { return begin() == end(); }
+  bool empty() const noexcept { return !size_; }
 
   size_type size() const noexcept { return size_; }
 
-  size_type max_size() const noexcept {
-    return std::numeric_limits<size_type>::max() / sizeof(vector<value_type>);
-  }
-
-  void reserve(size_type new_cap) {
-    if (new_cap > max_size()) {
-      throw std::length_error("capacity exceeds max size");
-    }
-    if (new_cap > capacity_) {
-      recap(new_cap);
-    }
-  }
-
   size_type capacity() const noexcept { return capacity_; }
 
-  void shrink_to_fit() { capacity_ = size_; }
-
-  void clear() noexcept { size_ = 0; }
+  void clear() noexcept {
+    std::destroy(container_, container_ + size_);
+    size_ = 0;
+  }
 
-  iterator insert(const_iterator pos, const T &value) noexcept {
-    return insert(pos, 1, value);
+  iterator insert(const_iterator pos, const T &value) {
+    return emplace(pos, value);
   }
 
-  iterator insert(const_iterator pos, const T &&value) noexcept {
-    return insert(pos, 1, std::move(value));
+  iterator insert(const_iterator pos, T &&value) {
+    return emplace(pos, std::move(value));
   }
 
-  iterator insert(const_iterator pos, size_type count,
-                  const T &value) noexcept {
-    size_type position = &(*pos) - container_;
-    if (position != size_) {
-      s21::vector<value_type> result(*this);
-      if (size_ + count >= capacity_) {
-        result.reserve(size_ + count);
-      }
-      result.size_ += count;
-      for (size_type i = position; i < position + count; i++) {
-        if (i < size_) {
-          result.container_[i + count] = result.container_[i];
-        }
-        result.container_[i] = value;
-      }
-      for (size_type i = position + count; i < result.size_; i++) {
-        result.container_[i] = container_[i - count];
-      }
-      swap(result);
+  // Constructs an element from args in front of pos. Without reallocation
+  // the tail is shifted by one slot; args may refer to elements of this
+  // vector.
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args &&... args) {
+    size_type position = pos - cbegin();
+    if (size_ == capacity_) {
+      realloc_emplace(position, std::forward<Args>(args)...);
+    } else if (position == size_) {
+      ::new (static_cast<void *>(container_ + size_))
+          value_type(std::forward<Args>(args)...);
+      size_++;
     } else {
-      for (size_type i = 0; i < count; i++) {
-        push_back(value);
+      value_type value(std::forward<Args>(args)...);
+      ::new (static_cast<void *>(container_ + size_))
+          value_type(std::move(container_[size_ - 1]));
+      std::move_backward(container_ + position, container_ + size_ - 1,
+                         container_ + size_);
+      container_[position] = std::move(value);
+      size_++;
+    }
+    return iterator(container_ + position);
+  }
+
+  // Inserts in at most one reallocation and one shift of the tail.
+  iterator insert(const_iterator pos, size_type count, const T &value) {
+    size_type position = pos - cbegin();
+    if (count) {
+      const value_type copy(value);
+      insert_gap(position, count, [&copy, count](pointer out, size_type live) {
+        std::fill_n(out, live, copy);
+        std::uninitialized_fill_n(out + live, count - live, copy);
+      });
+    }
+    return iterator(container_ + position);
+  }
+
+  // Inserts [first, last), which must not point into this vector. Forward
+  // ranges take one shift of the tail; single-pass ones are appended and
+  // rotated into place.
+  template <class InputIt,
+            class = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type position = pos - cbegin();
+    if constexpr (is_forward_iterator<InputIt>::value) {
+      size_type count = std::distance(first, last);
+      if (count) {
+        insert_gap(position, count, [&first, last](pointer out,
+                                                   size_type live) {
+          for (size_type i = 0; i < live; i++, ++first) out[i] = *first;
+          std::uninitialized_copy(first, last, out + live);
+        });
       }
+    } else {
+      size_type old_size = size_;
+      append(first, last);
+      std::rotate(container_ + position, container_ + old_size,
+                  container_ + size_);
     }
-    iterator it(position + container_);
-    return it;
+    return iterator(container_ + position);
   }
 
-  iterator insert(const_iterator pos, std::initializer_list<T> ilist) noexcept {
-    size_type position = &(*pos) - container_;
-    int count = 0;
-    for (auto it = ilist.begin(); it < ilist.end(); it++) {
-      const_iterator insert_it(const_cast<value_type *>(position + container_));
-      for (int i = 0; i < count; i++) {
-        insert_it++;
-      }
-      if (position == size_) {
-        push_back(*it);
-      } else {
-        insert(insert_it, 1, *it);
-      }
-      count++;
+  iterator insert(const_iterator pos, std::initializer_list<T> ilist) {
+    return insert(pos, ilist.begin(), ilist.end());
+  }
+
+  template <class InputIt>
+  void append(InputIt first, InputIt last) {
+    if constexpr (is_forward_iterator<InputIt>::value) {
+      insert(cend(), first, last);
+    } else {
+      for (; first != last; ++first) emplace_back(*first);
     }
-    iterator r_it(position + container_);
-    return r_it;
   }
 
   template <class... Args>
   iterator insert_many(const_iterator pos, Args &&... args) {
-    std::initializer_list ilist = {std::forward<Args>(args)...};
-    return insert(pos, ilist);
+    std::initializer_list<value_type> ilist = {std::forward<Args>(args)...};
+    return insert(pos, ilist.begin(), ilist.end());
   }
 
   template <class... Args>
   void insert_many_back(Args &&... args) {
-    std::initializer_list ilist = {std::forward<Args>(args)...};
-    auto pos = end();
-    insert(pos, ilist);
+    std::initializer_list<value_type> ilist = {std::forward<Args>(args)...};
+    append(ilist.begin(), ilist.end());
   }
 
   iterator erase(const_iterator pos) noexcept {
-    size_type position = &(*pos) - container_;
-    if (position == size_ - 1) {
-      size_--;
-      return end();
-    }
-    for (size_type i = position; i < size_ - 1; i++) {
-      container_[i] = container_[i + 1];
-    }
-    size_--;
-    iterator it(position + container_);
-    return it;
+    return erase(pos, pos + 1);
   }
 
   iterator erase(const_iterator first, const_iterator last) noexcept {
-    size_type first_position = &(*first) - container_;
-    size_type diff = &(*last) - container_ - first_position;
-    if (last == cend()) {
+    size_type first_position = first - cbegin();
+    size_type diff = last - first;
+    if (diff) {
+      std::move(container_ + first_position + diff, container_ + size_,
+                container_ + first_position);
+      std::destroy(container_ + size_ - diff, container_ + size_);
       size_ -= diff;
-      return end();
     }
-    for (size_type i = first_position; i < size_ - diff; i++) {
-      container_[i] = container_[i + diff];
-    }
-    size_ -= diff;
-    iterator it(first_position + container_);
-    return it;
+    return iterator(container_ + first_position);
   }
 
-  void push_back(const T &value) {
+  void push_back(const T &value) { emplace_back(value); }
+
+  void push_back(T &&value) { emplace_back(std::move(value)); }
+
+  // Constructs an element from args at the end and returns it.
+  template <class... Args>
+  reference emplace_back(Args &&... args) {
     if (size_ == capacity_) {
-      size_type new_size = (size_) ? (size_ * 2) : 1;
-      recap(new_size);
+      realloc_emplace(size_, std::forward<Args>(args)...);
+    } else {
+      ::new (static_cast<void *>(container_ + size_))
+          value_type(std::forward<Args>(args)...);
+      size_++;
     }
-    container_[size_] = value;
-    size_++;
+    return back();
   }
 
-  void push_back(const T &&value) { push_back(value); }
+  void pop_back() { std::destroy_at(container_ + --size_); }
 
-  void pop_back() {
-    size_--;
-    if (size_ == capacity_ / 2) {
-      recap(size_);
+  void resize(size_type count) {
+    resize_with(count, [](pointer first, pointer last) {
+      std::uninitialized_value_construct(first, last);
+    });
+  }
+
+  void resize(size_type count, const value_type &value) {
+    resize_with(count, [&value](pointer first, pointer last) {
+      fill_raw(first, last - first, value);
+    });
+  }
+
+  // Like resize(), but new elements are default-initialized: for arithmetic
+  // types the added slots are left indeterminate instead of zeroed, which
+  // saves a pass over buffers that are about to be overwritten.
+  void resize_default_init(size_type count) {
+    resize_with(count, [](pointer first, pointer last) {
+      std::uninitialized_default_construct(first, last);
+    });
+  }
+
+  allocator_type get_allocator() const noexcept { return alloc(); }
+
+ protected:
+  vector_base() = default;
+
+  explicit vector_base(const allocator_type &alloc) noexcept
+      : holder(alloc) {}
+
+  Derived &self() noexcept { return static_cast<Derived &>(*this); }
+
+  const Derived &self() const noexcept {
+    return static_cast<const Derived &>(*this);
+  }
+
+  pointer allocate(size_type count) {
+    return alloc_traits::allocate(alloc(), count);
+  }
+
+  // Releases storage from allocate() that never became the vector's own.
+  void deallocate(pointer storage, size_type count) noexcept {
+    alloc_traits::deallocate(alloc(), storage, count);
+  }
+
+  // Constructs count copies of value at out, with the SIMD fill for
+  // arithmetic types.
+  static void fill_raw(pointer out, size_type count, const T &value) {
+    if constexpr (simd::is_vectorizable_v<value_type>) {
+      simd::fill(out, count, value);
+    } else {
+      std::uninitialized_fill_n(out, count, value);
     }
   }
 
-  void resize(size_type count) { resize(count, value_type()); }
+  // Capacity allocated when an explicit request for count slots is made.
+  size_type fit_capacity(size_type count) const {
+    check_capacity(count);
+    return std::min(Growth::fit(count), self().max_size());
+  }
 
-  void resize(size_type count, const value_type &value) {
-    if (count > size_) {
-      recap(count);
-      std::fill(container_ + size_, container_ + count, value);
+  // Capacity to grow to when size() has to reach required.
+  size_type grown_capacity(size_type required) const {
+    check_capacity(required);
+    return std::min(Growth::grow(capacity_, required), self().max_size());
+  }
+
+  void check_capacity(size_type count) const {
+    if (count > self().max_size()) {
+      throw std::length_error("capacity exceeds max size");
+    }
+  }
+
+  // Moves the elements to new storage of new_cap slots, as adopt() does. If
+  // that throws, the new storage is freed and the vector is unchanged.
+  void reallocate(size_type new_cap) {
+    pointer new_container = allocate(new_cap);
+    try {
+      adopt(new_container, new_cap);
+    } catch (...) {
+      deallocate(new_container, new_cap);
+      throw;
+    }
+  }
+
+  void adopt(pointer new_container, size_type new_cap) {
+    adopt(new_container, new_cap, size_, 0);
+  }
+
+  // Relocates the live elements into new_container, which has room for
+  // new_cap, leaving gap slots free at position, and releases the old
+  // storage. If relocating throws, the vector still owns its old storage
+  // and new_container is left to the caller.
+  void adopt(pointer new_container, size_type new_cap, size_type position,
+             size_type gap) {
+    relocate_around(container_, container_ + position, container_ + size_,
+                    new_container, gap);
+    self().deallocate();
+    container_ = new_container;
+    capacity_ = new_cap;
+  }
+
+  // Inserts count elements in front of position, built by fill(out, live):
+  // it assigns the first live slots of out and constructs the others, and
+  // if it throws, the live slots must still hold objects and the others be
+  // raw. A vector that has to grow builds the elements in the new storage
+  // and is left unchanged if that fails. Otherwise the tail is shifted in
+  // place and moved back if fill throws; a tail whose moves throw as well
+  // is destroyed from there on.
+  template <class Fill>
+  void insert_gap(size_type position, size_type count, Fill fill) {
+    if (size_ + count > capacity_) {
+      size_type new_cap = grown_capacity(size_ + count);
+      pointer new_container = allocate(new_cap);
+      pointer out = new_container + position;
+      bool built = false;
+      try {
+        fill(out, 0);
+        built = true;
+        adopt(new_container, new_cap, position, count);
+      } catch (...) {
+        if (built) std::destroy(out, out + count);
+        deallocate(new_container, new_cap);
+        throw;
+      }
+    } else {
+      pointer out = container_ + position;
+      size_type live = shift_tail(out, container_ + size_, count);
+      try {
+        fill(out, live);
+      } catch (...) {
+        size_ = position + unshift_tail(out, size_ - position, count, live);
+        throw;
+      }
+    }
+    size_ += count;
+  }
+
+  // Grows a full vector and constructs an element from args at position.
+  // The element is constructed before the old storage is released, so args
+  // may refer to elements of this vector. If anything throws, the new
+  // storage and element are released and the vector is unchanged.
+  template <class... Args>
+  void realloc_emplace(size_type position, Args &&... args) {
+    size_type new_cap = grown_capacity(size_ + 1);
+    pointer new_container = allocate(new_cap);
+    pointer slot = new_container + position;
+    bool built = false;
+    try {
+      ::new (static_cast<void *>(slot)) value_type(std::forward<Args>(args)...);
+      built = true;
+      adopt(new_container, new_cap, position, 1);
+    } catch (...) {
+      if (built) std::destroy_at(slot);
+      deallocate(new_container, new_cap);
+      throw;
+    }
+    size_++;
+  }
+
+  // Shrinks by destroying the tail or grows by letting construct(first,
+  // last) fill the new slots. The current storage is reused when it is large
+  // enough; otherwise the slots are filled before the old storage is freed,
+  // and both are released again if anything throws.
+  template <class Construct>
+  void resize_with(size_type count, Construct construct) {
+    if (count > capacity_) {
+      size_type new_cap = grown_capacity(count);
+      pointer new_container = allocate(new_cap);
+      bool built = false;
+      try {
+        construct(new_container + size_, new_container + count);
+        built = true;
+        adopt(new_container, new_cap);
+      } catch (...) {
+        if (built) std::destroy(new_container + size_, new_container + count);
+        deallocate(new_container, new_cap);
+        throw;
+      }
+    } else if (count > size_) {
+      construct(container_ + size_, container_ + count);
+    } else {
+      std::destroy(container_ + count, container_ + size_);
     }
     size_ = count;
   }
 
-  void swap(vector &other) noexcept {
-    std::swap(size_, other.size_);
-    std::swap(capacity_, other.capacity_);
-    std::swap(container_, other.container_);
+  size_type size_;
+  size_type capacity_;
+  pointer container_;
+};
+
+// Heap-allocated vector: a default constructed vector owns no storage.
+template <class T, class Allocator = std::allocator<T>,
+          class Growth = pow2_growth>
+class vector
+    : public vector_base<vector<T, Allocator, Growth>, T, Allocator, Growth> {
+  using base = vector_base<vector, T, Allocator, Growth>;
+  using typename base::alloc_traits;
+  using base::alloc;
+  using base::capacity_;
+  using base::container_;
+  using base::size_;
+  friend base;
+
+ public:
+  using typename base::allocator_type;
+  using typename base::const_reference;
+  using typename base::pointer;
+  using typename base::value_type;
+
+  vector() { nullify(); }
+
+  // The other constructors delegate here, so that the destructor frees the
+  // storage if filling it throws.
+  explicit vector(const allocator_type &alloc) : base(alloc) { nullify(); }
+
+  explicit vector(size_type count, const_reference value,
+                  const allocator_type &alloc = allocator_type())
+      : vector(alloc) {
+    init(count);
+    base::fill_raw(container_, count, value);
+    size_ = count;
+  }
+
+  explicit vector(size_type count,
+                  const allocator_type &alloc = allocator_type())
+      : vector(alloc) {
+    init(count);
+    std::uninitialized_value_construct_n(container_, count);
+    size_ = count;
+  }
+
+  vector(const vector &v)
+      : vector(v, alloc_traits::select_on_container_copy_construction(
+                      v.alloc())) {}
+
+  vector(const vector &v, const allocator_type &alloc) : vector(alloc) {
+    init(v.size_);
+    std::uninitialized_copy_n(v.container_, v.size_, container_);
+    size_ = v.size_;
+  }
+
+  vector(vector &&v) noexcept : base(std::move(v.alloc())) {
+    nullify();
+    swap_storage(v);
+  }
+
+  // Takes the storage of v when alloc can free it and moves the elements
+  // one by one otherwise.
+  vector(vector &&v, const allocator_type &alloc) : vector(alloc) {
+    if (this->same_alloc(v.alloc())) {
+      swap_storage(v);
+    } else {
+      move_elements(v);
+    }
+  }
+
+  vector(std::initializer_list<value_type> ilist,
+         const allocator_type &alloc = allocator_type())
+      : vector(alloc) {
+    init(ilist.size());
+    std::uninitialized_copy(ilist.begin(), ilist.end(), container_);
+    size_ = ilist.size();
+  }
+
+  ~vector() {
+    this->clear();
+    deallocate();
+  }
+
+  vector &operator=(const vector &other) {
+    if (this != &other) {
+      constexpr bool propagate =
+          alloc_traits::propagate_on_container_copy_assignment::value;
+      vector v(other, propagate ? other.alloc() : alloc());
+      release();
+      this->copy_alloc(other.alloc());
+      swap_storage(v);
+    }
+    return *this;
+  }
+
+  // Steals the storage of other unless the allocators differ and do not
+  // propagate, in which case the elements are moved one by one.
+  vector &operator=(vector &&other) noexcept(
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value) {
+    if (this != &other) {
+      if (alloc_traits::propagate_on_container_move_assignment::value ||
+          this->same_alloc(other.alloc())) {
+        release();
+        this->move_alloc(other.alloc());
+        swap_storage(other);
+      } else {
+        this->clear();
+        move_elements(other);
+      }
+    }
+    return *this;
+  }
+
+  vector &operator=(std::initializer_list<T> ilist) {
+    if (size_ != ilist.size()) {
+      vector v(ilist, alloc());
+      swap_storage(v);
+    } else {
+      std::copy(ilist.begin(), ilist.end(), container_);
+    }
+    return *this;
   }
 
-  template <class U>
-  friend bool operator==(const vector<U> &lhs, const vector<U> &rhs);
+  void assign(size_type count, const_reference value) {
+    vector v(count, value, alloc());
+    swap_storage(v);
+  }
 
-  template <class U>
-  friend bool operator!=(const vector<U> &lhs, const vector<U> &rhs);
+  void assign(std::initializer_list<T> ilist) { *this = ilist; }
 
-  template <class U>
-  friend bool operator<(const vector<U> &lhs, const vector<U> &rhs);
+  size_type max_size() const noexcept {
+    return std::min<size_type>(
+        std::numeric_limits<size_type>::max() / sizeof(vector),
+        alloc_traits::max_size(alloc()));
+  }
 
-  template <class U>
-  friend bool operator<=(const vector<U> &lhs, const vector<U> &rhs);
+  void reserve(size_type new_cap) {
+    if (new_cap > max_size()) {
+      throw std::length_error("capacity exceeds max size");
+    }
+    if (new_cap > capacity_) {
+      recap(new_cap);
+    }
+  }
 
-  template <class U>
-  friend bool operator>(const vector<U> &lhs, const vector<U> &rhs);
+  // Reallocates to exactly size() slots, releasing the unused ones.
+  void shrink_to_fit() {
+    if (size_ == capacity_) return;
+    if (!size_) {
+      deallocate();
+      nullify();
+      return;
+    }
+    this->reallocate(size_);
+  }
 
-  template <class U>
-  friend bool operator>=(const vector<U> &lhs, const vector<U> &rhs);
+  // The allocators are exchanged only if they propagate on swap; otherwise
+  // they must compare equal.
+  void swap(vector &other) noexcept {
+    this->swap_alloc(other.alloc());
+    swap_storage(other);
+  }
 
  private:
   void nullify() noexcept {
@@ -433,105 +871,111 @@ class vector {
     container_ = nullptr;
   }
 
+  // Leaves the vector empty with room for size elements.
   void init(size_type size) {
     nullify();
-    size_ = size;
     recap(size);
   }
 
+  using base::deallocate;
+
+  // Releases the storage; the elements must have been destroyed.
   void deallocate() noexcept {
     if (container_) {
-      delete[] container_;
+      alloc_traits::deallocate(alloc(), container_, capacity_);
       container_ = nullptr;
     }
   }
 
-  void recap() { recap(size_); }
-
-  void recap(size_type new_cap) {
-    if (!new_cap) {
-      deallocate();
-      nullify();
-      return;
-    }
-    size_type old_cap = capacity_;
-    if (new_cap - 1) {
-      new_cap -= 1;
-      while (new_cap & (new_cap - 1)) {
-        new_cap &= (new_cap - 1);
-      }
-      new_cap <<= 1;
-    }
-    if (new_cap > max_size()) {
-      throw std::length_error("capacity exceeds max size");
-    }
-    capacity_ = new_cap;
-    pointer new_container = new value_type[capacity_];
-    std::copy(container_, container_ + std::min(old_cap, capacity_),
-              new_container);
+  // Destroys the elements and leaves the vector without storage.
+  void release() noexcept {
+    this->clear();
     deallocate();
-    container_ = new_container;
+    nullify();
   }
 
-  size_type size_;
-  size_type capacity_;
-  pointer container_;
-};
+  void swap_storage(vector &other) noexcept {
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(container_, other.container_);
+  }
 
-template <class T>
-bool operator==(const vector<T> &lhs, const vector<T> &rhs) {
-  if (lhs.size() != rhs.size()) {
-    return false;
+  // Moves the elements of other to the end of this vector and empties it.
+  void move_elements(vector &other) {
+    this->append(std::make_move_iterator(other.container_),
+                 std::make_move_iterator(other.container_ + other.size_));
+    other.clear();
   }
-  for (size_type i = 0; i < lhs.size(); i++) {
-    if (lhs[i] != rhs[i]) {
-      return false;
-    }
+
+  // Moves the elements to storage of fit_capacity(new_cap) slots, which
+  // must be at least size().
+  void recap(size_type new_cap) {
+    if (!new_cap) return;
+    this->reallocate(this->fit_capacity(new_cap));
   }
-  return true;
+};
+
+// The comparisons and find() and count() below take vector and small_vector
+// alike and run the SIMD kernels of s21_simd.h for arithmetic element types.
+
+template <class D, class T, class A, class G>
+bool operator==(const vector_base<D, T, A, G> &lhs,
+                const vector_base<D, T, A, G> &rhs) {
+  return lhs.size() == rhs.size() &&
+         simd::equal(lhs.data(), rhs.data(), lhs.size());
 }
 
-template <class T>
-bool operator!=(const vector<T> &lhs, const vector<T> &rhs) {
+template <class D, class T, class A, class G>
+bool operator!=(const vector_base<D, T, A, G> &lhs,
+                const vector_base<D, T, A, G> &rhs) {
   return !(lhs == rhs);
 }
 
-template <class T>
-bool operator<(const vector<T> &lhs, const vector<T> &rhs) {
-  size_type min_size = std::min(lhs.size(), rhs.size());
-  for (size_type idx = 0; idx < min_size; ++idx) {
-    if (lhs[idx] < rhs[idx]) {
-      return true;
-    } else if (lhs[idx] > rhs[idx]) {
-      return false;
-    }
-  }
-  return lhs.size() < rhs.size();
+template <class D, class T, class A, class G>
+bool operator<(const vector_base<D, T, A, G> &lhs,
+               const vector_base<D, T, A, G> &rhs) {
+  return simd::lexicographical_compare(lhs.data(), lhs.size(), rhs.data(),
+                                       rhs.size());
 }
 
-template <class T>
-bool operator<=(const vector<T> &lhs, const vector<T> &rhs) {
-  return !(lhs > rhs);
+template <class D, class T, class A, class G>
+bool operator<=(const vector_base<D, T, A, G> &lhs,
+                const vector_base<D, T, A, G> &rhs) {
+  return !(rhs < lhs);
 }
 
-template <class T>
-bool operator>(const vector<T> &lhs, const vector<T> &rhs) {
-  size_type min_size = std::min(lhs.size(), rhs.size());
-  for (size_type idx = 0; idx < min_size; ++idx) {
-    if (lhs[idx] > rhs[idx]) {
-      return true;
-    } else if (lhs[idx] < rhs[idx]) {
-      return false;
-    }
-  }
-  return lhs.size() > rhs.size();
+template <class D, class T, class A, class G>
+bool operator>(const vector_base<D, T, A, G> &lhs,
+               const vector_base<D, T, A, G> &rhs) {
+  return rhs < lhs;
 }
 
-template <class T>
-bool operator>=(const vector<T> &lhs, const vector<T> &rhs) {
+template <class D, class T, class A, class G>
+bool operator>=(const vector_base<D, T, A, G> &lhs,
+                const vector_base<D, T, A, G> &rhs) {
   return !(lhs < rhs);
 }
 
+// First element equal to value, or end().
+template <class D, class T, class A, class G>
+typename vector_base<D, T, A, G>::iterator find(vector_base<D, T, A, G> &v,
+                                                const T &value) {
+  return typename vector_base<D, T, A, G>::iterator(
+      v.data() + simd::find(v.data(), v.size(), value));
+}
+
+template <class D, class T, class A, class G>
+typename vector_base<D, T, A, G>::const_iterator find(
+    const vector_base<D, T, A, G> &v, const T &value) {
+  return typename vector_base<D, T, A, G>::const_iterator(
+      v.data() + simd::find(v.data(), v.size(), value));
+}
+
+template <class D, class T, class A, class G>
+size_type count(const vector_base<D, T, A, G> &v, const T &value) {
+  return simd::count(v.data(), v.size(), value);
+}
+
 }  // namespace s21
 
 #endif  // S21_CONTAINERS_SRC_S21_VECTOR_H
@@ -0,0 +1,375 @@
+#ifndef S21_CONTAINERS_SRC_S21_VERSIONED_MAP_H
+#define S21_CONTAINERS_SRC_S21_VERSIONED_MAP_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+
+#include "s21_vector.h"
+
+namespace s21 {
+template <class K, class T>
+struct VersionedNode {
+  using key_type = K;
+  using value_type = T;
+  using node_ptr = std::shared_ptr<const VersionedNode>;
+
+  VersionedNode(const key_type &k, const value_type &v, node_ptr l,
+                node_ptr r)
+      : key(k), value(v), left(std::move(l)), right(std::move(r)) {
+    int lh = left ? left->height : 0;
+    int rh = right ? right->height : 0;
+    height = 1 + (lh > rh ? lh : rh);
+  }
+
+  key_type key;
+  value_type value;
+  int height;
+  node_ptr left;
+  node_ptr right;
+};
+
+namespace {
+template <class K, class T>
+class VersionedMapIterator {
+ public:
+  using key_type = K;
+  using value_type = T;
+  using node_type = VersionedNode<key_type, value_type>;
+  using reference = const value_type &;
+
+  VersionedMapIterator() : depth_(0) {}
+
+  explicit VersionedMapIterator(const node_type *root) : depth_(0) {
+    push_left(root);
+  }
+
+  bool operator==(const VersionedMapIterator &other) const {
+    return get_pointer() == other.get_pointer();
+  }
+
+  bool operator!=(const VersionedMapIterator &other) const {
+    return !(*this == other);
+  }
+
+  reference operator*() const { return path_[depth_ - 1]->value; }
+
+  VersionedMapIterator &operator++() {
+    const node_type *node = path_[--depth_];
+    push_left(node->right.get());
+    return *this;
+  }
+
+  VersionedMapIterator operator++(int) {
+    VersionedMapIterator it = *this;
+    ++(*this);
+    return it;
+  }
+
+  const key_type &get_key() const { return path_[depth_ - 1]->key; }
+
+  const node_type *get_pointer() const {
+    return depth_ ? path_[depth_ - 1] : nullptr;
+  }
+
+ private:
+  // An AVL tree of n nodes is less than 1.45 log2(n) + 2 high.
+  static constexpr int kMaxHeight = 96;
+
+  void push_left(const node_type *node) {
+    for (; node != nullptr; node = node->left.get()) path_[depth_++] = node;
+  }
+
+  // Nodes still to be visited whose left subtrees are done; nodes carry no
+  // parent links because they are shared between versions.
+  const node_type *path_[kMaxHeight];
+  int depth_;
+};
+}  // namespace
+
+// Multi-version map. Every committed write builds a new version by copying
+// the path from the root to the changed node (an AVL tree of immutable,
+// reference counted nodes) and publishes it atomically, so writers never
+// block readers. A snapshot pins one version and can be read and iterated
+// for as long as it lives; a version no snapshot holds any more is freed
+// with the nodes it does not share with newer versions.
+template <class K, class T>
+class versioned_map {
+ public:
+  using key_type = K;
+  using value_type = T;
+  using size_type = std::size_t;
+  using version_type = unsigned long long;
+  using node_type = VersionedNode<key_type, value_type>;
+  using node_ptr = typename node_type::node_ptr;
+  using iterator = VersionedMapIterator<key_type, value_type>;
+  using const_iterator = iterator;
+
+ private:
+  struct state {
+    node_ptr root;
+    size_type size;
+    version_type version;
+  };
+  using state_ptr = std::shared_ptr<const state>;
+
+ public:
+  // Read-only view of one version.
+  class snapshot {
+   public:
+    snapshot() {}
+
+    const_iterator begin() const { return const_iterator(root()); }
+
+    const_iterator end() const { return const_iterator(); }
+
+    bool empty() const noexcept { return !size(); }
+
+    size_type size() const noexcept { return state_ ? state_->size : 0; }
+
+    version_type version() const noexcept {
+      return state_ ? state_->version : 0;
+    }
+
+    const value_type &at(const key_type &key) const {
+      const node_type *node = find_node(key);
+      if (node == nullptr) {
+        throw std::out_of_range("Key doesn't exist");
+      }
+      return node->value;
+    }
+
+    bool contains(const key_type &key) const {
+      return find_node(key) != nullptr;
+    }
+
+    // Calls fn(key, value) for every element in key order. If fn returns
+    // bool, false stops the walk.
+    template <class Fn>
+    void for_each(Fn fn) const {
+      for (auto it = begin(); it != end(); ++it) {
+        if constexpr (std::is_same_v<decltype(fn(it.get_key(), *it)),
+                                     bool>) {
+          if (!fn(it.get_key(), *it)) break;
+        } else {
+          fn(it.get_key(), *it);
+        }
+      }
+    }
+
+   private:
+    friend versioned_map;
+
+    explicit snapshot(state_ptr s) : state_(std::move(s)) {}
+
+    const node_type *root() const {
+      return state_ ? state_->root.get() : nullptr;
+    }
+
+    const node_type *find_node(const key_type &key) const {
+      const node_type *node = root();
+      while (node != nullptr) {
+        if (key < node->key)
+          node = node->left.get();
+        else if (node->key < key)
+          node = node->right.get();
+        else
+          break;
+      }
+      return node;
+    }
+
+    state_ptr state_;
+  };
+
+  versioned_map() : current_(std::make_shared<const state>(state{})) {}
+
+  versioned_map(
+      std::initializer_list<std::pair<const key_type, value_type>> items)
+      : versioned_map() {
+    for (auto it = items.begin(); it != items.end(); ++it) {
+      insert(it->first, it->second);
+    }
+  }
+
+  versioned_map(const versioned_map &) = delete;
+
+  versioned_map &operator=(const versioned_map &) = delete;
+
+  // The latest committed version.
+  snapshot get_snapshot() const {
+    return snapshot(std::atomic_load(&current_));
+  }
+
+  // An older version, as long as some snapshot still holds it.
+  snapshot get_snapshot(version_type version) const {
+    state_ptr current = std::atomic_load(&current_);
+    if (current->version == version) return snapshot(current);
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    for (size_type i = 0; i < history_.size(); i++) {
+      state_ptr s = history_[i].lock();
+      if (s && s->version == version) return snapshot(s);
+    }
+    throw std::out_of_range("Version is no longer available");
+  }
+
+  version_type version() const noexcept { return get_snapshot().version(); }
+
+  size_type size() const noexcept { return get_snapshot().size(); }
+
+  bool empty() const noexcept { return !size(); }
+
+  bool contains(const key_type &key) const {
+    return get_snapshot().contains(key);
+  }
+
+  // Writers below are serialized by a mutex; each one that changes the map
+  // commits exactly one new version.
+  bool insert(const key_type &key, const value_type &value) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    state_ptr old = std::atomic_load(&current_);
+    bool inserted = false;
+    node_ptr root = insert_node(old->root, key, value, false, inserted);
+    if (inserted) commit(old, std::move(root), old->size + 1);
+    return inserted;
+  }
+
+  // Returns true if the key was inserted, false if its value was replaced.
+  bool insert_or_assign(const key_type &key, const value_type &value) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    state_ptr old = std::atomic_load(&current_);
+    bool inserted = false;
+    node_ptr root = insert_node(old->root, key, value, true, inserted);
+    commit(old, std::move(root), old->size + inserted);
+    return inserted;
+  }
+
+  bool erase(const key_type &key) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    state_ptr old = std::atomic_load(&current_);
+    bool erased = false;
+    node_ptr root = erase_node(old->root, key, erased);
+    if (erased) commit(old, std::move(root), old->size - 1);
+    return erased;
+  }
+
+  // Versions that are still alive: the current one and those held by
+  // snapshots.
+  size_type live_versions() const {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    size_type res = 1;
+    for (size_type i = 0; i < history_.size(); i++) {
+      res += !history_[i].expired();
+    }
+    return res;
+  }
+
+ private:
+  static int height(const node_ptr &node) { return node ? node->height : 0; }
+
+  static node_ptr make_node(const node_type &from, node_ptr left,
+                            node_ptr right) {
+    return std::make_shared<const node_type>(from.key, from.value,
+                                             std::move(left),
+                                             std::move(right));
+  }
+
+  // Builds a node over left and right, rotating once or twice if their
+  // heights differ by two.
+  static node_ptr balance(const node_type &from, node_ptr left,
+                          node_ptr right) {
+    if (height(left) > height(right) + 1) {
+      if (height(left->left) >= height(left->right)) {
+        return make_node(*left, left->left,
+                         make_node(from, left->right, right));
+      }
+      const node_type &mid = *left->right;
+      return make_node(mid, make_node(*left, left->left, mid.left),
+                       make_node(from, mid.right, right));
+    }
+    if (height(right) > height(left) + 1) {
+      if (height(right->right) >= height(right->left)) {
+        return make_node(*right, make_node(from, left, right->left),
+                         right->right);
+      }
+      const node_type &mid = *right->left;
+      return make_node(mid, make_node(from, left, mid.left),
+                       make_node(*right, mid.right, right->right));
+    }
+    return make_node(from, std::move(left), std::move(right));
+  }
+
+  static node_ptr insert_node(const node_ptr &node, const key_type &key,
+                              const value_type &value, bool assign,
+                              bool &inserted) {
+    if (!node) {
+      inserted = true;
+      return std::make_shared<const node_type>(key, value, nullptr, nullptr);
+    }
+    if (key < node->key) {
+      node_ptr left = insert_node(node->left, key, value, assign, inserted);
+      return left == node->left ? node : balance(*node, left, node->right);
+    }
+    if (node->key < key) {
+      node_ptr right = insert_node(node->right, key, value, assign, inserted);
+      return right == node->right ? node : balance(*node, node->left, right);
+    }
+    if (!assign) return node;
+    return std::make_shared<const node_type>(key, value, node->left,
+                                             node->right);
+  }
+
+  static node_ptr erase_min(const node_ptr &node, node_ptr &min) {
+    if (!node->left) {
+      min = node;
+      return node->right;
+    }
+    return balance(*node, erase_min(node->left, min), node->right);
+  }
+
+  static node_ptr erase_node(const node_ptr &node, const key_type &key,
+                             bool &erased) {
+    if (!node) return node;
+    if (key < node->key) {
+      node_ptr left = erase_node(node->left, key, erased);
+      return erased ? balance(*node, left, node->right) : node;
+    }
+    if (node->key < key) {
+      node_ptr right = erase_node(node->right, key, erased);
+      return erased ? balance(*node, node->left, right) : node;
+    }
+    erased = true;
+    if (!node->left) return node->right;
+    if (!node->right) return node->left;
+    node_ptr min;
+    node_ptr right = erase_min(node->right, min);
+    return balance(*min, node->left, right);
+  }
+
+  // Publishes the version after old; called with write_mutex_ held. old
+  // joins the history, where it stays reachable until its last snapshot
+  // goes away.
+  void commit(const state_ptr &old, node_ptr root, size_type size) {
+    std::atomic_store(&current_,
+                      std::make_shared<const state>(
+                          state{std::move(root), size, old->version + 1}));
+    size_type alive = 0;
+    for (size_type i = 0; i < history_.size(); i++) {
+      if (!history_[i].expired()) history_[alive++] = history_[i];
+    }
+    while (history_.size() > alive) {
+      history_[history_.size() - 1].reset();
+      history_.pop_back();
+    }
+    history_.push_back(old);
+  }
+
+  state_ptr current_;
+  vector<std::weak_ptr<const state>> history_;
+  mutable std::mutex write_mutex_;
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_SRC_S21_VERSIONED_MAP_H
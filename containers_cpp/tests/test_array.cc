@@ -453,3 +453,17 @@ TEST(test_array, ge) {
   a[0] = 2;
   ASSERT_GE(a, b);  // {2, 0, 0} >= {1, 3, 0}
 }
+
+TEST(test_array, find_count_fill) {
+  s21::array<short, 50> arr;
+  arr.fill(3);
+  arr[41] = 4;
+  ASSERT_EQ(&*s21::find(arr, short(4)) - arr.data(), 41);
+  ASSERT_TRUE(s21::find(arr, short(5)) == arr.end());
+  ASSERT_EQ(s21::count(arr, short(3)), 49);
+
+  s21::array<short, 50> other(3);
+  ASSERT_LT(other, arr);
+  other[41] = 4;
+  ASSERT_EQ(other, arr);
+}
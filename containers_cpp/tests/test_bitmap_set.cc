@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <set>
+
+#include "../src/s21_bitmap_set.h"
+
+namespace {
+std::set<std::uint32_t> to_std(const s21::bitmap_set &s) {
+  std::set<std::uint32_t> res;
+  for (auto it = s.begin(); it != s.end(); ++it) res.insert(*it);
+  return res;
+}
+}  // namespace
+
+TEST(test_bitmap_set, create) {
+  s21::bitmap_set s;
+  ASSERT_TRUE(s.empty());
+  ASSERT_EQ(s.size(), 0);
+  ASSERT_TRUE(s.begin() == s.end());
+  ASSERT_FALSE(s.contains(0));
+}
+
+TEST(test_bitmap_set, insert_erase_contains) {
+  s21::bitmap_set s({7, 1, 70000, 0xffffffff, 1});
+  ASSERT_EQ(s.size(), 4);
+  ASSERT_TRUE(s.contains(70000));
+  ASSERT_TRUE(s.contains(0xffffffff));
+  ASSERT_FALSE(s.contains(70001));
+  ASSERT_FALSE(s.insert(7));
+  ASSERT_TRUE(s.insert(8));
+  ASSERT_EQ(s.erase(70000), 1);
+  ASSERT_EQ(s.erase(70000), 0);
+  ASSERT_FALSE(s.contains(70000));
+  std::uint32_t expected[] = {1, 7, 8, 0xffffffff};
+  int n = 0;
+  for (auto it = s.begin(); it != s.end(); ++it) ASSERT_EQ(*it, expected[n++]);
+  ASSERT_EQ(n, 4);
+}
+
+TEST(test_bitmap_set, dense_chunks_become_bitmaps) {
+  s21::bitmap_set s;
+  for (std::uint32_t i = 0; i < 100000; i += 2) s.insert(i);
+  ASSERT_EQ(s.size(), 50000);
+  ASSERT_TRUE(s.contains(99998));
+  ASSERT_FALSE(s.contains(99999));
+  ASSERT_LT(s.memory_usage(), 2 * 8192 + 1024);
+  for (std::uint32_t i = 0; i < 100000; i += 4) s.erase(i);
+  ASSERT_EQ(s.size(), 25000);
+  std::uint32_t expected = 2;
+  for (auto it = s.begin(); it != s.end(); ++it, expected += 4) {
+    ASSERT_EQ(*it, expected);
+  }
+  ASSERT_EQ(expected, 100002);
+}
+
+TEST(test_bitmap_set, run_optimize) {
+  s21::bitmap_set s;
+  for (std::uint32_t i = 1000; i < 60000; i++) s.insert(i);
+  s.insert(65536 + 5);
+  std::size_t before = s.memory_usage();
+  s.run_optimize();
+  ASSERT_LT(s.memory_usage(), before / 20);
+  ASSERT_EQ(s.size(), 59001);
+  ASSERT_TRUE(s.contains(1000));
+  ASSERT_TRUE(s.contains(59999));
+  ASSERT_FALSE(s.contains(999));
+  ASSERT_FALSE(s.contains(60000));
+  std::uint32_t expected = 1000;
+  for (auto it = s.begin(); *it < 65536; ++it) ASSERT_EQ(*it, expected++);
+  ASSERT_TRUE(s.insert(60000));
+  ASSERT_EQ(s.erase(1000), 1);
+  ASSERT_EQ(s.size(), 59001);
+  ASSERT_FALSE(s.contains(1000));
+}
+
+TEST(test_bitmap_set, for_each) {
+  s21::bitmap_set s({3, 65536, 1 << 20});
+  std::uint64_t sum = 0;
+  s.for_each([&sum](std::uint32_t v) { sum += v; });
+  ASSERT_EQ(sum, 3 + 65536 + (1 << 20));
+}
+
+TEST(test_bitmap_set, set_algebra) {
+  s21::bitmap_set a({1, 2, 3, 70000}), b({2, 3, 4, 140000});
+  ASSERT_TRUE((a | b) == s21::bitmap_set({1, 2, 3, 4, 70000, 140000}));
+  ASSERT_TRUE((a & b) == s21::bitmap_set({2, 3}));
+  ASSERT_TRUE((a - b) == s21::bitmap_set({1, 70000}));
+  ASSERT_TRUE((b - a) == s21::bitmap_set({4, 140000}));
+  a &= s21::bitmap_set({70000});
+  ASSERT_EQ(a.size(), 1);
+  ASSERT_TRUE(a != b);
+}
+
+// Mixes array, bitmap and run chunks on both sides.
+TEST(test_bitmap_set, random_algebra) {
+  std::mt19937 gen(1);
+  for (int round = 0; round < 6; round++) {
+    s21::bitmap_set a, b;
+    std::set<std::uint32_t> sa, sb;
+    for (int i = 0; i < 30000; i++) {
+      std::uint32_t chunk = gen() % 4;
+      std::uint32_t range = chunk == 0 ? 65536 : chunk == 1 ? 3000 : 20000;
+      std::uint32_t v = chunk << 16 | (gen() % range);
+      if (gen() % 2) {
+        a.insert(v);
+        sa.insert(v);
+      } else {
+        b.insert(v);
+        sb.insert(v);
+      }
+    }
+    for (std::uint32_t v = 3 << 16; v < (3 << 16) + 5000; v++) {
+      a.insert(v);
+      sa.insert(v);
+    }
+    if (round % 2) a.run_optimize();
+    if (round % 3) b.run_optimize();
+    std::set<std::uint32_t> u, n, d;
+    for (auto v : sa) (sb.count(v) ? n : d).insert(v);
+    u = sa;
+    u.insert(sb.begin(), sb.end());
+    ASSERT_EQ(to_std(a | b), u);
+    ASSERT_EQ(to_std(a & b), n);
+    ASSERT_EQ(to_std(a - b), d);
+    ASSERT_EQ(to_std(b & a), n);
+    std::set<std::uint32_t> e;
+    for (auto v : sb) {
+      if (!sa.count(v)) e.insert(v);
+    }
+    ASSERT_EQ(to_std(b - a), e);
+    ASSERT_EQ((a | b).size(), u.size());
+    ASSERT_EQ(to_std(a), sa);
+  }
+}
@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+
+#include "../src/s21_bloom_filter.h"
+
+TEST(test_bloom_filter, create) {
+  s21::bloom_filter<int> filter(1000, 4);
+  ASSERT_EQ(filter.bit_count(), 1024);
+  ASSERT_EQ(filter.hash_count(), 4);
+  ASSERT_FALSE(filter.might_contain(1));
+}
+
+TEST(test_bloom_filter, no_false_negatives) {
+  s21::bloom_filter<int> filter(1 << 12);
+  for (int i = 0; i < 300; i++) filter.insert(i * 7);
+  for (int i = 0; i < 300; i++) ASSERT_TRUE(filter.might_contain(i * 7));
+}
+
+TEST(test_bloom_filter, few_false_positives) {
+  s21::bloom_filter<int> filter(1 << 14);
+  for (int i = 0; i < 1000; i++) filter.insert(2 * i);
+  int false_positives = 0;
+  for (int i = 0; i < 1000; i++) {
+    false_positives += filter.might_contain(2 * i + 1);
+  }
+  ASSERT_LT(false_positives, 50);
+}
+
+TEST(test_bloom_filter, clear) {
+  s21::bloom_filter<int> filter(256);
+  filter.insert(5);
+  filter.stats().erased_since_rebuild = 3;
+  filter.clear();
+  ASSERT_FALSE(filter.might_contain(5));
+  ASSERT_EQ(filter.stats().erased_since_rebuild, 0);
+}
+
+TEST(test_bloom_filter, false_positive_rate) {
+  s21::bloom_stats stats = {10, 6, 2, 0};
+  ASSERT_DOUBLE_EQ(stats.false_positive_rate(), 0.25);
+  stats = s21::bloom_stats();
+  ASSERT_DOUBLE_EQ(stats.false_positive_rate(), 0);
+}
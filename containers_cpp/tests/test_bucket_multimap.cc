@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+
+#include "../src/s21_bucket_multimap.h"
+
+TEST(test_bucket_multimap, create_default) {
+  s21::bucket_multimap<int, int> m;
+  ASSERT_TRUE(m.empty());
+  ASSERT_EQ(m.count(1), 0);
+  ASSERT_EQ(m.values(1), nullptr);
+  ASSERT_TRUE(m.begin() == m.end());
+}
+
+TEST(test_bucket_multimap, create_from_ilist) {
+  s21::bucket_multimap<int, char> m(
+      {{2, 'a'}, {1, 'b'}, {2, 'c'}, {3, 'd'}, {2, 'e'}});
+  ASSERT_EQ(m.size(), 5);
+  ASSERT_EQ(m.distinct_size(), 3);
+  ASSERT_EQ(m.count(2), 3);
+  const auto* values = m.values(2);
+  ASSERT_EQ(values->size(), 3);
+  ASSERT_EQ(values->data()[0], 'a');
+  ASSERT_EQ(values->data()[1], 'c');
+  ASSERT_EQ(values->data()[2], 'e');
+}
+
+TEST(test_bucket_multimap, iteration) {
+  s21::bucket_multimap<int, int> m({{2, 20}, {1, 10}, {2, 21}, {3, 30}});
+  int keys[] = {1, 2, 2, 3};
+  int values[] = {10, 20, 21, 30};
+  int n = 0;
+  for (auto it = m.begin(); it != m.end(); ++it, n++) {
+    ASSERT_EQ(it.get_key(), keys[n]);
+    ASSERT_EQ(*it, values[n]);
+  }
+  ASSERT_EQ(n, 4);
+  auto it = m.end();
+  --it;
+  ASSERT_EQ(*it, 30);
+  --it;
+  ASSERT_EQ(*it, 21);
+  auto range = m.equal_range(2);
+  n = 0;
+  for (it = range.first; it != range.second; ++it) n++;
+  ASSERT_EQ(n, 2);
+}
+
+TEST(test_bucket_multimap, erase) {
+  s21::bucket_multimap<int, int> m({{1, 10}, {1, 11}, {1, 12}, {2, 20}});
+  auto it = m.find(1);
+  ++it;
+  it = m.erase(it);
+  ASSERT_EQ(*it, 12);
+  it = m.erase(it);
+  ASSERT_EQ(it.get_key(), 2);
+  ASSERT_EQ(m.count(1), 1);
+  it = m.erase(m.find(1));
+  ASSERT_EQ(*it, 20);
+  ASSERT_FALSE(m.contains(1));
+  ASSERT_EQ(m.erase(2), 1);
+  ASSERT_TRUE(m.empty());
+}
+
+TEST(test_bucket_multimap, merge_copy_and_compare) {
+  s21::bucket_multimap<int, int> m({{1, 1}, {2, 2}});
+  s21::bucket_multimap<int, int> other({{2, 3}, {4, 4}});
+  m.merge(other);
+  ASSERT_TRUE(other.empty());
+  ASSERT_EQ(m.size(), 4);
+  ASSERT_EQ(m.count(2), 2);
+  s21::bucket_multimap<int, int> copy(m);
+  ASSERT_TRUE(copy == m);
+  copy.insert(2, 5);
+  ASSERT_TRUE(copy != m);
+  s21::bucket_multimap<int, int> moved(std::move(copy));
+  ASSERT_TRUE(copy.empty());
+  ASSERT_EQ(moved.count(2), 3);
+}
+
+TEST(test_bucket_multimap, for_each_early_exit) {
+  s21::bucket_multimap<int, int> m({{1, 1}, {2, 2}, {2, 3}, {3, 4}});
+  int sum = 0;
+  m.for_each([&sum](const int&, const int& value) {
+    sum += value;
+    return value < 3;
+  });
+  ASSERT_EQ(sum, 1 + 2 + 3);
+}
+
+TEST(test_bucket_multimap, random_operations) {
+  s21::bucket_multimap<int, int> m;
+  std::multimap<int, int> expected;
+  std::mt19937 gen(1);
+  for (int i = 0; i < 2000; i++) {
+    int key = static_cast<int>(gen() % 50);
+    if (gen() % 4) {
+      m.insert(key, i);
+      expected.emplace(key, i);
+    } else {
+      ASSERT_EQ(m.erase(key), expected.erase(key));
+    }
+    ASSERT_EQ(m.count(key), expected.count(key));
+  }
+  ASSERT_EQ(m.size(), expected.size());
+  auto it = m.begin();
+  for (auto& entry : expected) {
+    ASSERT_EQ(it.get_key(), entry.first);
+    ASSERT_EQ(*it, entry.second);
+    ++it;
+  }
+}
+
+namespace {
+// Stateful allocator charging the bytes it hands out to an arena counter.
+// Allocators of different arenas compare unequal and do not propagate.
+template <class T>
+struct ArenaAllocator {
+  using value_type = T;
+
+  explicit ArenaAllocator(long* arena) : bytes(arena) {}
+
+  template <class U>
+  ArenaAllocator(const ArenaAllocator<U>& other) : bytes(other.bytes) {}
+
+  T* allocate(std::size_t n) {
+    *bytes += n * sizeof(T);
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* p, std::size_t n) {
+    *bytes -= n * sizeof(T);
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  bool operator==(const ArenaAllocator& other) const {
+    return bytes == other.bytes;
+  }
+
+  bool operator!=(const ArenaAllocator& other) const {
+    return bytes != other.bytes;
+  }
+
+  long* bytes;
+};
+
+using arena_multimap =
+    s21::bucket_multimap<int, int, std::less<int>,
+                         ArenaAllocator<std::pair<const int, int>>>;
+}  // namespace
+
+TEST(test_bucket_multimap, allocator_serves_nodes_and_buckets) {
+  long bytes1 = 0;
+  long bytes2 = 0;
+  ArenaAllocator<std::pair<const int, int>> arena1(&bytes1);
+  ArenaAllocator<std::pair<const int, int>> arena2(&bytes2);
+  {
+    arena_multimap m(arena1);
+    m.insert(1, 10);
+    long one_value = bytes1;
+    m.insert(1, 11);
+    ASSERT_GT(bytes1, one_value);
+
+    arena_multimap other(arena2);
+    other = m;
+    ASSERT_GT(bytes2, 0);
+    ASSERT_TRUE(other == m);
+    other.clear();
+    ASSERT_EQ(bytes2, 0);
+
+    other = std::move(m);
+    ASSERT_TRUE(m.empty());
+    ASSERT_EQ(bytes1, 0);
+    ASSERT_EQ(other.count(1), 2);
+  }
+  ASSERT_EQ(bytes1, 0);
+  ASSERT_EQ(bytes2, 0);
+}
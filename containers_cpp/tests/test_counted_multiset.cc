@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+
+#include "../src/s21_counted_multiset.h"
+
+TEST(test_counted_multiset, create_default) {
+  s21::counted_multiset<int> s;
+  ASSERT_TRUE(s.empty());
+  ASSERT_EQ(s.size(), 0);
+  ASSERT_TRUE(s.begin() == s.end());
+}
+
+TEST(test_counted_multiset, create_from_ilist) {
+  s21::counted_multiset<int> s({3, 1, 3, 2, 3, 1});
+  ASSERT_EQ(s.size(), 6);
+  ASSERT_EQ(s.distinct_size(), 3);
+  ASSERT_EQ(s.count(1), 2);
+  ASSERT_EQ(s.count(2), 1);
+  ASSERT_EQ(s.count(3), 3);
+  ASSERT_EQ(s.count(4), 0);
+}
+
+TEST(test_counted_multiset, iterate_every_occurrence) {
+  s21::counted_multiset<int> s({3, 1, 3, 2, 3, 1});
+  int expected[] = {1, 1, 2, 3, 3, 3};
+  int i = 0;
+  for (auto it = s.begin(); it != s.end(); ++it) {
+    ASSERT_EQ(*it, expected[i++]);
+  }
+  ASSERT_EQ(i, 6);
+  auto it = s.end();
+  for (i = 5; i >= 0; i--) {
+    --it;
+    ASSERT_EQ(*it, expected[i]);
+  }
+  ASSERT_TRUE(it == s.begin());
+}
+
+TEST(test_counted_multiset, insert_many_occurrences) {
+  s21::counted_multiset<int> s;
+  auto it = s.insert(7, 1000000);
+  ASSERT_EQ(*it, 7);
+  ASSERT_EQ(it.get_index(), 999999);
+  it = s.insert(7);
+  ASSERT_EQ(it.get_index(), 1000000);
+  ASSERT_EQ(s.size(), 1000001);
+  ASSERT_EQ(s.distinct_size(), 1);
+  ASSERT_EQ(s.count(7), 1000001);
+}
+
+TEST(test_counted_multiset, erase_key) {
+  s21::counted_multiset<int> s({5, 5, 5, 8});
+  ASSERT_EQ(s.erase(5), 3);
+  ASSERT_EQ(s.erase(5), 0);
+  ASSERT_EQ(s.size(), 1);
+  ASSERT_FALSE(s.contains(5));
+  ASSERT_TRUE(s.contains(8));
+}
+
+TEST(test_counted_multiset, erase_one_occurrence) {
+  s21::counted_multiset<int> s({5, 5, 8});
+  auto it = s.erase(s.find(5));
+  ASSERT_EQ(*it, 5);
+  ASSERT_EQ(s.count(5), 1);
+  it = s.erase(it);
+  ASSERT_EQ(*it, 8);
+  ASSERT_FALSE(s.contains(5));
+  it = s.erase(it);
+  ASSERT_TRUE(it == s.end());
+  ASSERT_TRUE(s.empty());
+}
+
+TEST(test_counted_multiset, equal_range) {
+  s21::counted_multiset<int> s({1, 4, 4, 4, 9});
+  auto range = s.equal_range(4);
+  int n = 0;
+  for (auto it = range.first; it != range.second; ++it) {
+    ASSERT_EQ(*it, 4);
+    n++;
+  }
+  ASSERT_EQ(n, 3);
+  ASSERT_EQ(*s.lower_bound(5), 9);
+  ASSERT_EQ(*s.upper_bound(1), 4);
+  ASSERT_TRUE(s.upper_bound(9) == s.end());
+  range = s.equal_range(6);
+  ASSERT_TRUE(range.first == range.second);
+}
+
+TEST(test_counted_multiset, copy_and_move) {
+  s21::counted_multiset<int> s({2, 2, 3});
+  s21::counted_multiset<int> c(s);
+  ASSERT_TRUE(c == s);
+  s21::counted_multiset<int> m(std::move(c));
+  ASSERT_TRUE(m == s);
+  ASSERT_TRUE(c.empty());
+  c = m;
+  c.insert(3);
+  ASSERT_TRUE(c != m);
+}
+
+TEST(test_counted_multiset, merge_and_swap) {
+  s21::counted_multiset<int> a({1, 2, 2});
+  s21::counted_multiset<int> b({2, 3});
+  a.merge(b);
+  ASSERT_TRUE(b.empty());
+  ASSERT_EQ(a.size(), 5);
+  ASSERT_EQ(a.count(2), 3);
+  a.swap(b);
+  ASSERT_TRUE(a.empty());
+  ASSERT_EQ(b.size(), 5);
+}
+
+TEST(test_counted_multiset, random_operations) {
+  s21::counted_multiset<int> s;
+  std::map<int, std::size_t> expected;
+  std::size_t size = 0;
+  std::mt19937 gen(1);
+  for (int i = 0; i < 5000; i++) {
+    int key = static_cast<int>(gen() % 50);
+    switch (gen() % 3) {
+      case 0:
+        s.insert(key);
+        expected[key]++;
+        size++;
+        break;
+      case 1: {
+        auto it = s.find(key);
+        if (it != s.end()) {
+          s.erase(it);
+          if (--expected[key] == 0) expected.erase(key);
+          size--;
+        }
+        break;
+      }
+      default:
+        ASSERT_EQ(s.count(key), expected.count(key) ? expected[key] : 0);
+    }
+  }
+  ASSERT_EQ(s.size(), size);
+  ASSERT_EQ(s.distinct_size(), expected.size());
+  auto it = s.begin();
+  for (auto &entry : expected) {
+    for (std::size_t i = 0; i < entry.second; i++) {
+      ASSERT_EQ(*it, entry.first);
+      ++it;
+    }
+  }
+  ASSERT_TRUE(it == s.end());
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include "../src/s21_map.h"
+#include "../src/s21_multiset.h"
+#include "../src/s21_set.h"
+
+TEST(test_frozen_tree, freeze_empty_set) {
+  s21::set<int> set;
+  auto frozen = set.freeze();
+  ASSERT_TRUE(frozen.empty());
+  ASSERT_EQ(frozen.size(), 0);
+  ASSERT_FALSE(frozen.contains(1));
+  ASSERT_TRUE(frozen.begin() == frozen.end());
+  ASSERT_TRUE(frozen.lower_bound(1) == frozen.end());
+}
+
+TEST(test_frozen_tree, contains) {
+  s21::set<int> set;
+  for (int i = 0; i < 200; i += 2) {
+    set.insert(i);
+  }
+  auto frozen = set.freeze();
+  ASSERT_EQ(frozen.size(), 100);
+  for (int i = -5; i < 205; i++) {
+    ASSERT_EQ(frozen.contains(i), set.contains(i));
+  }
+}
+
+TEST(test_frozen_tree, iterate_in_key_order) {
+  s21::set<int> set({5, 3, 9, 1, 7, 2, 8, 4, 6, 0});
+  auto frozen = set.freeze();
+  int expected = 0;
+  for (auto it = frozen.begin(); it != frozen.end(); ++it) {
+    ASSERT_EQ(*it, expected);
+    ASSERT_EQ(it.get_key(), expected);
+    expected++;
+  }
+  ASSERT_EQ(expected, 10);
+}
+
+TEST(test_frozen_tree, iterate_backwards) {
+  s21::set<int> set({5, 3, 9, 1, 7, 2, 8, 4, 6, 0, 10, 11});
+  auto frozen = set.freeze();
+  auto it = frozen.end();
+  for (int expected = 11; expected >= 0; expected--) {
+    --it;
+    ASSERT_EQ(*it, expected);
+  }
+  ASSERT_TRUE(it == frozen.begin());
+}
+
+TEST(test_frozen_tree, lower_and_upper_bound) {
+  s21::set<int> set({10, 20, 30, 40, 50});
+  auto frozen = set.freeze();
+  ASSERT_EQ(*frozen.lower_bound(5), 10);
+  ASSERT_EQ(*frozen.lower_bound(20), 20);
+  ASSERT_EQ(*frozen.lower_bound(21), 30);
+  ASSERT_TRUE(frozen.lower_bound(51) == frozen.end());
+  ASSERT_EQ(*frozen.upper_bound(20), 30);
+  ASSERT_EQ(*frozen.upper_bound(49), 50);
+  ASSERT_TRUE(frozen.upper_bound(50) == frozen.end());
+}
+
+TEST(test_frozen_tree, find) {
+  s21::set<int> set({1, 2, 3});
+  auto frozen = set.freeze();
+  ASSERT_EQ(*frozen.find(2), 2);
+  ASSERT_TRUE(frozen.find(4) == frozen.end());
+}
+
+TEST(test_frozen_tree, freeze_map) {
+  s21::map<int, char> map({std::make_pair(3, 'c'), std::make_pair(1, 'a'),
+                           std::make_pair(2, 'b')});
+  auto frozen = map.freeze();
+  ASSERT_EQ(frozen.at(1), 'a');
+  ASSERT_EQ(frozen.at(3), 'c');
+  ASSERT_ANY_THROW(frozen.at(4));
+  auto it = frozen.begin();
+  ASSERT_EQ(it.get_key(), 1);
+  ASSERT_EQ(*it, 'a');
+  ++it;
+  ASSERT_EQ(it.get_key(), 2);
+  ASSERT_EQ(*it, 'b');
+}
+
+TEST(test_frozen_tree, freeze_multiset) {
+  s21::multiset<int> set({1, 2, 2, 2, 3});
+  auto frozen = set.freeze();
+  ASSERT_EQ(frozen.size(), 5);
+  ASSERT_EQ(frozen.count(2), 3);
+  ASSERT_EQ(frozen.count(4), 0);
+  auto range = frozen.equal_range(2);
+  int n = 0;
+  for (auto it = range.first; it != range.second; ++it) {
+    ASSERT_EQ(*it, 2);
+    n++;
+  }
+  ASSERT_EQ(n, 3);
+}
+
+TEST(test_frozen_tree, independent_of_source) {
+  s21::set<int> set({1, 2, 3});
+  auto frozen = set.freeze();
+  set.insert(4);
+  set.erase(1);
+  ASSERT_TRUE(frozen.contains(1));
+  ASSERT_FALSE(frozen.contains(4));
+}
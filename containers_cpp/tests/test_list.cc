@@ -480,3 +480,73 @@ TEST(test_list, insert_many_front) {
   it++;
   ASSERT_EQ(*it, 3);
 }
+
+namespace {
+// Stateful allocator charging the bytes it hands out to an arena counter.
+// Allocators of different arenas compare unequal and do not propagate.
+template <class T>
+struct ArenaAllocator {
+  using value_type = T;
+
+  explicit ArenaAllocator(long* arena) : bytes(arena) {}
+
+  template <class U>
+  ArenaAllocator(const ArenaAllocator<U>& other) : bytes(other.bytes) {}
+
+  T* allocate(std::size_t n) {
+    *bytes += n * sizeof(T);
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* p, std::size_t n) {
+    *bytes -= n * sizeof(T);
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  bool operator==(const ArenaAllocator& other) const {
+    return bytes == other.bytes;
+  }
+
+  bool operator!=(const ArenaAllocator& other) const {
+    return bytes != other.bytes;
+  }
+
+  long* bytes;
+};
+
+using arena_list = s21::list<int, ArenaAllocator<int>>;
+}  // namespace
+
+TEST(test_list, allocator_rebinds_to_nodes) {
+  long bytes = 0;
+  {
+    arena_list lst({1, 2, 3}, ArenaAllocator<int>(&bytes));
+    ASSERT_EQ(bytes, 3 * sizeof(s21::dnode<int>));
+    lst.push_front(0);
+    lst.erase(++lst.begin());
+    ASSERT_EQ(bytes, 3 * sizeof(s21::dnode<int>));
+
+    arena_list copy(lst);
+    ASSERT_TRUE(copy.get_allocator() == ArenaAllocator<int>(&bytes));
+    ASSERT_EQ(bytes, 6 * sizeof(s21::dnode<int>));
+  }
+  ASSERT_EQ(bytes, 0);
+}
+
+TEST(test_list, allocator_move_between_arenas) {
+  long bytes1 = 0;
+  long bytes2 = 0;
+  ArenaAllocator<int> arena1(&bytes1);
+  ArenaAllocator<int> arena2(&bytes2);
+  {
+    arena_list lst({1, 2, 3}, arena1);
+    arena_list other(arena2);
+    other = std::move(lst);
+    ASSERT_TRUE(lst.empty());
+    ASSERT_EQ(other.size(), 3);
+    ASSERT_EQ(other.back(), 3);
+    ASSERT_EQ(bytes1, 0);
+    ASSERT_EQ(bytes2, 3 * sizeof(s21::dnode<int>));
+  }
+  ASSERT_EQ(bytes2, 0);
+}
@@ -0,0 +1,233 @@
+#include <gtest/gtest.h>
+
+#include <list>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "../src/s21_lru_cache.h"
+
+TEST(test_lru_cache, create) {
+  s21::lru_cache<int, int> c(3);
+  ASSERT_TRUE(c.empty());
+  ASSERT_EQ(c.max_count(), 3);
+  ASSERT_EQ(c.max_bytes(), 0);
+  ASSERT_EQ(c.get(1), nullptr);
+  ASSERT_EQ(c.get_stats().misses, 1);
+}
+
+TEST(test_lru_cache, get_and_put) {
+  s21::lru_cache<int, std::string> c(3);
+  ASSERT_TRUE(c.put(1, "one"));
+  ASSERT_TRUE(c.put(2, "two"));
+  ASSERT_EQ(*c.get(1), "one");
+  ASSERT_TRUE(c.put(2, "deux"));
+  ASSERT_EQ(c.size(), 2);
+  ASSERT_EQ(*c.get(2), "deux");
+  *c.get(1) = "un";
+  ASSERT_EQ(*c.get(1), "un");
+  ASSERT_EQ(c.get_stats().hits, 4);
+  ASSERT_EQ(c.get_stats().misses, 0);
+  ASSERT_DOUBLE_EQ(c.get_stats().hit_rate(), 1);
+}
+
+TEST(test_lru_cache, evicts_least_recently_used) {
+  s21::lru_cache<int, int> c(3);
+  c.put(1, 10);
+  c.put(2, 20);
+  c.put(3, 30);
+  c.get(1);
+  c.put(4, 40);
+  ASSERT_EQ(c.size(), 3);
+  ASSERT_FALSE(c.contains(2));
+  ASSERT_TRUE(c.contains(1));
+  c.put(5, 50);
+  ASSERT_FALSE(c.contains(3));
+  ASSERT_EQ(c.get_stats().evictions, 2);
+  int order[3], n = 0;
+  c.for_each([&](const int &key, const int &) { order[n++] = key; });
+  ASSERT_EQ(n, 3);
+  ASSERT_EQ(order[0], 5);
+  ASSERT_EQ(order[1], 4);
+  ASSERT_EQ(order[2], 1);
+}
+
+TEST(test_lru_cache, contains_does_not_refresh) {
+  s21::lru_cache<int, int> c(2);
+  c.put(1, 1);
+  c.put(2, 2);
+  ASSERT_TRUE(c.contains(1));
+  c.put(3, 3);
+  ASSERT_FALSE(c.contains(1));
+  ASSERT_EQ(c.get_stats().hits + c.get_stats().misses, 0);
+}
+
+TEST(test_lru_cache, byte_capacity) {
+  s21::lru_cache<int, int> c(100, 10);
+  c.put(1, 1, 4);
+  c.put(2, 2, 4);
+  ASSERT_EQ(c.bytes(), 8);
+  c.put(3, 3, 4);
+  ASSERT_EQ(c.size(), 2);
+  ASSERT_FALSE(c.contains(1));
+  ASSERT_EQ(c.bytes(), 8);
+  c.put(2, 2, 9);
+  ASSERT_EQ(c.size(), 1);
+  ASSERT_TRUE(c.contains(2));
+  ASSERT_EQ(c.bytes(), 9);
+  ASSERT_FALSE(c.put(4, 4, 11));
+  ASSERT_FALSE(c.put(2, 2, 11));
+  ASSERT_TRUE(c.empty());
+  ASSERT_EQ(c.bytes(), 0);
+}
+
+TEST(test_lru_cache, erase_and_clear) {
+  s21::lru_cache<int, int> c(4);
+  for (int i = 0; i < 4; i++) c.put(i, i);
+  ASSERT_TRUE(c.erase(2));
+  ASSERT_FALSE(c.erase(2));
+  ASSERT_EQ(c.size(), 3);
+  c.put(5, 5);
+  ASSERT_EQ(c.get_stats().evictions, 0);
+  c.clear();
+  ASSERT_TRUE(c.empty());
+  ASSERT_EQ(c.bytes(), 0);
+  c.put(1, 1);
+  ASSERT_EQ(*c.get(1), 1);
+}
+
+TEST(test_lru_cache, releases_evicted_values) {
+  // The cache's copies of payload are the only owners besides this one, so
+  // use_count shows whether a dropped entry still holds its value.
+  auto payload = std::make_shared<std::string>(1000, 'x');
+  s21::lru_cache<int, std::shared_ptr<std::string>> c(2);
+  c.put(1, payload);
+  c.put(2, payload);
+  c.put(3, payload);
+  ASSERT_EQ(payload.use_count(), 3);
+  c.erase(3);
+  ASSERT_EQ(payload.use_count(), 2);
+  c.put(5, payload);
+  c.set_capacity(1);
+  ASSERT_EQ(payload.use_count(), 2);
+  c.clear();
+  ASSERT_EQ(payload.use_count(), 1);
+  c.put(4, payload);
+  ASSERT_EQ(**c.get(4), *payload);
+}
+
+namespace {
+// Key whose copy constructor throws once copies_left copies have been
+// made; a negative copies_left never throws. put() copies the key into the
+// list entry first and into the index node second.
+struct FragileKey {
+  static int copies_left;
+
+  FragileKey(int id = 0) : id(id) {}
+
+  FragileKey(const FragileKey &other) : id(other.id) {
+    if (copies_left == 0) throw std::runtime_error("copy");
+    if (copies_left > 0) copies_left--;
+  }
+
+  FragileKey(FragileKey &&other) = default;
+
+  FragileKey &operator=(const FragileKey &other) = default;
+
+  bool operator<(const FragileKey &other) const { return id < other.id; }
+
+  bool operator>(const FragileKey &other) const { return id > other.id; }
+
+  int id;
+};
+
+int FragileKey::copies_left = -1;
+}  // namespace
+
+TEST(test_lru_cache, failed_put_leaves_cache_intact) {
+  s21::lru_cache<FragileKey, int> c(3);
+  c.put(1, 10, 4);
+  c.put(2, 20, 4);
+  FragileKey::copies_left = 1;
+  ASSERT_THROW(c.put(3, 30, 4), std::runtime_error);
+  FragileKey::copies_left = -1;
+  ASSERT_EQ(c.size(), 2);
+  ASSERT_EQ(c.bytes(), 8);
+  ASSERT_FALSE(c.contains(3));
+  int entries = 0;
+  c.for_each([&entries](const FragileKey &, int) { entries++; });
+  ASSERT_EQ(entries, 2);
+  c.put(3, 30, 4);
+  c.put(4, 40, 4);
+  ASSERT_EQ(c.size(), 3);
+  ASSERT_FALSE(c.contains(1));
+  ASSERT_EQ(*c.get(3), 30);
+}
+
+TEST(test_lru_cache, set_capacity) {
+  s21::lru_cache<int, int> c(5);
+  for (int i = 0; i < 5; i++) c.put(i, i);
+  c.get(0);
+  c.set_capacity(2);
+  ASSERT_EQ(c.size(), 2);
+  ASSERT_TRUE(c.contains(0));
+  ASSERT_TRUE(c.contains(4));
+}
+
+TEST(test_lru_cache, copy_and_move) {
+  s21::lru_cache<int, int> c(3);
+  c.put(1, 1);
+  c.put(2, 2);
+  c.put(3, 3);
+  c.get(1);
+  s21::lru_cache<int, int> copy(c);
+  copy.put(4, 4);
+  ASSERT_FALSE(copy.contains(2));
+  ASSERT_TRUE(c.contains(2));
+  s21::lru_cache<int, int> moved(std::move(copy));
+  ASSERT_TRUE(copy.empty());
+  ASSERT_EQ(moved.size(), 3);
+  ASSERT_EQ(*moved.get(4), 4);
+}
+
+TEST(test_lru_cache, random_operations) {
+  const std::size_t capacity = 50;
+  s21::lru_cache<int, int> c(capacity);
+  std::list<std::pair<int, int>> order;
+  std::map<int, std::list<std::pair<int, int>>::iterator> index;
+  std::mt19937 gen(1);
+  for (int i = 0; i < 20000; i++) {
+    int key = static_cast<int>(gen() % 100);
+    auto found = index.find(key);
+    if (gen() % 2) {
+      int *value = c.get(key);
+      ASSERT_EQ(value != nullptr, found != index.end());
+      if (value != nullptr) {
+        ASSERT_EQ(*value, found->second->second);
+        order.splice(order.begin(), order, found->second);
+      }
+    } else {
+      c.put(key, i);
+      if (found != index.end()) {
+        found->second->second = i;
+        order.splice(order.begin(), order, found->second);
+      } else {
+        if (order.size() == capacity) {
+          index.erase(order.back().first);
+          order.pop_back();
+        }
+        order.emplace_front(key, i);
+        index[key] = order.begin();
+      }
+    }
+  }
+  ASSERT_EQ(c.size(), order.size());
+  auto it = order.begin();
+  c.for_each([&](const int &key, const int &value) {
+    ASSERT_EQ(key, it->first);
+    ASSERT_EQ(value, it->second);
+    ++it;
+  });
+}
@@ -520,3 +520,186 @@ TEST(test_map, is_greater_or_eq_false) {
   other.insert(3, 0);
   ASSERT_FALSE(map >= other);
 }
+
+TEST(test_map, contains_many) {
+  s21::map<int, int> map;
+  for (int i = 0; i < 100; i += 2) {
+    map.insert(i, i * 10);
+  }
+  int keys[40];
+  bool found[40];
+  for (int i = 0; i < 40; i++) {
+    keys[i] = i * 3;
+  }
+  map.contains_many(keys, keys + 40, found);
+  for (int i = 0; i < 40; i++) {
+    ASSERT_EQ(found[i], map.contains(keys[i]));
+  }
+}
+
+TEST(test_map, find_many) {
+  s21::map<int, int> map({std::make_pair(1, 10), std::make_pair(2, 20),
+                          std::make_pair(3, 30)});
+  int keys[] = {3, 4, 1};
+  s21::map<int, int>::iterator found[3];
+  map.find_many(keys, keys + 3, found);
+  ASSERT_EQ(*found[0], 30);
+  ASSERT_TRUE(found[1] == map.end());
+  ASSERT_EQ(*found[2], 10);
+}
+
+TEST(test_map, for_each_updates_values) {
+  s21::map<int, int> map;
+  for (int i = 0; i < 10; i++) map.insert(i, i);
+  map.for_each([](const int& key, int& value) { value = key * 10; });
+  int sum = 0;
+  map.for_each([&](const int&, const int& value) { sum += value; });
+  ASSERT_EQ(sum, 450);
+  ASSERT_EQ(map.at(7), 70);
+}
+
+TEST(test_map, for_each_in_range_early_exit) {
+  s21::map<int, int> map;
+  for (int i = 0; i < 100; i++) map.insert(i, -i);
+  int last = -1;
+  map.for_each_in_range(30, 60, [&](const int& key, const int& value) {
+    EXPECT_EQ(value, -key);
+    last = key;
+    return key < 40;
+  });
+  ASSERT_EQ(last, 40);
+}
+
+TEST(test_map, copy_keys_to) {
+  s21::map<int, int> map({std::make_pair(3, 30), std::make_pair(1, 10),
+                          std::make_pair(2, 20)});
+  s21::vector<int> keys;
+  map.copy_keys_to(keys);
+  ASSERT_EQ(keys.size(), 3);
+  ASSERT_EQ(keys[0], 1);
+  ASSERT_EQ(keys[2], 3);
+}
+
+TEST(test_map, compact) {
+  s21::map<int, int> map;
+  for (int i = 0; i < 100; i++) map.insert(i, i * 2);
+  for (int i = 0; i < 100; i += 3) map.erase(i);
+  map.compact();
+  ASSERT_EQ(map.size(), 66);
+  ASSERT_EQ(map.at(50), 100);
+  ASSERT_FALSE(map.contains(51));
+  map.insert(51, 7);
+  ASSERT_EQ(map.at(51), 7);
+  s21::map<int, int> copy(map);
+  ASSERT_TRUE(copy == map);
+}
+
+TEST(test_map, bloom_filter) {
+  s21::map<int, int> map({std::make_pair(1, 10), std::make_pair(5, 50)});
+  map.enable_bloom_filter(1024);
+  ASSERT_EQ(map.at(5), 50);
+  ASSERT_TRUE(map.find(4) == map.end());
+  map.insert(4, 40);
+  ASSERT_EQ(map.at(4), 40);
+  ASSERT_EQ(map.count(7), 0);
+  ASSERT_GE(map.get_bloom_stats().lookups, 4);
+}
+
+TEST(test_map, merkle_tracks_values) {
+  using merkle_map =
+      s21::map<int, int, std::less<int>,
+               std::allocator<std::pair<const int, int>>, s21::merkle<>>;
+  merkle_map a({std::make_pair(1, 10), std::make_pair(2, 20)});
+  merkle_map b(a);
+  a.enable_merkle();
+  b.enable_merkle();
+  ASSERT_EQ(a.merkle_hash(), b.merkle_hash());
+  b.insert_or_assign(2, 21);
+  ASSERT_NE(a.merkle_hash(), b.merkle_hash());
+  ASSERT_EQ(a.diff(b).size(), 1);
+  a[2] = 21;
+  a.refresh_merkle(2);
+  ASSERT_EQ(a.merkle_hash(), b.merkle_hash());
+  ASSERT_TRUE(a == b);
+}
+
+namespace {
+// Stateful allocator charging the bytes it hands out to an arena counter.
+// Allocators of different arenas compare unequal and do not propagate.
+template <class T>
+struct ArenaAllocator {
+  using value_type = T;
+
+  explicit ArenaAllocator(long* arena) : bytes(arena) {}
+
+  template <class U>
+  ArenaAllocator(const ArenaAllocator<U>& other) : bytes(other.bytes) {}
+
+  T* allocate(std::size_t n) {
+    *bytes += n * sizeof(T);
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* p, std::size_t n) {
+    *bytes -= n * sizeof(T);
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  bool operator==(const ArenaAllocator& other) const {
+    return bytes == other.bytes;
+  }
+
+  bool operator!=(const ArenaAllocator& other) const {
+    return bytes != other.bytes;
+  }
+
+  long* bytes;
+};
+
+using arena_map = s21::map<int, int, std::less<int>,
+                           ArenaAllocator<std::pair<const int, int>>>;
+}  // namespace
+
+TEST(test_map, allocator_rebinds_to_nodes) {
+  long bytes = 0;
+  ArenaAllocator<std::pair<const int, int>> arena(&bytes);
+  {
+    arena_map m(arena);
+    for (int i = 0; i < 10; i++) m.insert(i, i * i);
+    m.insert(3, 0);
+    ASSERT_EQ(bytes, 10 * sizeof(arena_map::node_type));
+
+    arena_map copy(m);
+    ASSERT_TRUE(copy.get_allocator() == arena);
+    copy.get_tree_ptr()->compact();
+    ASSERT_EQ(bytes, 20 * sizeof(arena_map::node_type));
+    copy.erase(copy.find(4));
+    copy.insert(40, 1);
+    ASSERT_EQ(copy.at(9), 81);
+
+    arena_map moved(std::move(copy));
+    ASSERT_EQ(moved.size(), 10);
+    // The erased node stays in the arena until the arena is released.
+    ASSERT_EQ(bytes, 21 * sizeof(arena_map::node_type));
+  }
+  ASSERT_EQ(bytes, 0);
+}
+
+TEST(test_map, allocator_move_between_arenas) {
+  long bytes1 = 0;
+  long bytes2 = 0;
+  ArenaAllocator<std::pair<const int, int>> arena1(&bytes1);
+  ArenaAllocator<std::pair<const int, int>> arena2(&bytes2);
+  {
+    arena_map m(arena1);
+    m.insert(1, 1);
+    m.insert(2, 4);
+    arena_map other(arena2);
+    other = std::move(m);
+    ASSERT_TRUE(m.empty());
+    ASSERT_EQ(other.at(2), 4);
+    ASSERT_EQ(bytes1, 0);
+    ASSERT_EQ(bytes2, 2 * sizeof(arena_map::node_type));
+  }
+  ASSERT_EQ(bytes2, 0);
+}
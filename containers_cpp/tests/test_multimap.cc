@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <string>
+
+#include "../src/s21_multimap.h"
+
+TEST(test_multimap, create_default) {
+  s21::multimap<int, int> m;
+  ASSERT_TRUE(m.empty());
+  ASSERT_EQ(m.count(1), 0);
+  ASSERT_TRUE(m.begin() == m.end());
+}
+
+TEST(test_multimap, create_from_ilist) {
+  s21::multimap<int, char> m(
+      {{2, 'a'}, {1, 'b'}, {2, 'c'}, {3, 'd'}, {2, 'e'}});
+  ASSERT_EQ(m.size(), 5);
+  ASSERT_EQ(m.count(1), 1);
+  ASSERT_EQ(m.count(2), 3);
+  ASSERT_EQ(m.count(4), 0);
+}
+
+TEST(test_multimap, values_keep_insertion_order) {
+  s21::multimap<int, int> m;
+  for (int i = 0; i < 100; i++) m.insert(i % 7, i);
+  auto range = m.equal_range(3);
+  int expected = 3, n = 0;
+  for (auto it = range.first; it != range.second; ++it, n++) {
+    ASSERT_EQ(it.get_key(), 3);
+    ASSERT_EQ(*it, expected);
+    expected += 7;
+  }
+  ASSERT_EQ(n, m.count(3));
+  int prev = -1;
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    ASSERT_LE(prev, it.get_key());
+    prev = it.get_key();
+  }
+}
+
+TEST(test_multimap, insert_returns_new_element) {
+  s21::multimap<int, int> m;
+  m.insert(1, 10);
+  auto it = m.insert(1, 11);
+  ASSERT_EQ(*it, 11);
+  ++it;
+  ASSERT_TRUE(it == m.end());
+}
+
+TEST(test_multimap, for_each_value) {
+  s21::multimap<int, int> m({{1, 1}, {2, 2}, {2, 3}, {2, 4}, {3, 5}});
+  int sum = 0;
+  m.for_each_value(2, [&sum](const int& value) { sum += value; });
+  ASSERT_EQ(sum, 9);
+  sum = 0;
+  m.for_each_value(2, [&sum](const int& value) {
+    sum += value;
+    return false;
+  });
+  ASSERT_EQ(sum, 2);
+}
+
+TEST(test_multimap, erase_and_merge) {
+  s21::multimap<int, int> m({{1, 1}, {2, 2}, {2, 3}});
+  s21::multimap<int, int> other({{2, 4}, {5, 5}});
+  m.merge(other);
+  ASSERT_TRUE(other.empty());
+  ASSERT_EQ(m.count(2), 3);
+  ASSERT_EQ(m.erase(2), 3);
+  ASSERT_EQ(m.size(), 2);
+  ASSERT_FALSE(m.contains(2));
+}
+
+TEST(test_multimap, copy_keeps_duplicates) {
+  s21::multimap<int, int> m({{1, 1}, {1, 2}});
+  s21::multimap<int, int> copy(m);
+  copy.insert(1, 3);
+  ASSERT_EQ(copy.count(1), 3);
+  ASSERT_EQ(m.count(1), 2);
+}
+
+TEST(test_multimap, random_operations) {
+  s21::multimap<int, int> m;
+  std::multimap<int, int> expected;
+  std::mt19937 gen(1);
+  for (int i = 0; i < 2000; i++) {
+    int key = static_cast<int>(gen() % 50);
+    if (gen() % 4) {
+      m.insert(key, i);
+      expected.emplace(key, i);
+    } else {
+      ASSERT_EQ(m.erase(key), expected.erase(key));
+    }
+    ASSERT_EQ(m.count(key), expected.count(key));
+  }
+  ASSERT_EQ(m.size(), expected.size());
+  auto it = m.begin();
+  for (auto& entry : expected) {
+    ASSERT_EQ(it.get_key(), entry.first);
+    ASSERT_EQ(*it, entry.second);
+    ++it;
+  }
+}
+
+TEST(test_multimap, erase_iterator_with_duplicate_keys) {
+  s21::multimap<int, char> m({{1, 'a'}, {1, 'b'}, {1, 'c'}, {2, 'z'}});
+  auto pos = m.begin();
+  ++pos;
+  ++pos;
+  ASSERT_EQ(*pos, 'c');
+  auto next = m.erase(pos);
+  ASSERT_EQ(next.get_key(), 2);
+  ASSERT_EQ(*next, 'z');
+  std::string rest;
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    rest += std::to_string(it.get_key()) + *it;
+  }
+  ASSERT_EQ(rest, "1a1b2z");
+
+  // Erasing a random position, with many equal keys, matches std::multimap.
+  s21::multimap<int, int> big;
+  std::multimap<int, int> expected;
+  std::mt19937 gen(7);
+  for (int i = 0; i < 300; i++) {
+    big.insert(i % 5, i);
+    expected.emplace(i % 5, i);
+  }
+  while (!expected.empty()) {
+    std::size_t index = gen() % expected.size();
+    auto it = big.begin();
+    auto expected_it = expected.begin();
+    for (std::size_t i = 0; i < index; i++) {
+      ++it;
+      ++expected_it;
+    }
+    it = big.erase(it);
+    expected_it = expected.erase(expected_it);
+    if (expected_it == expected.end()) {
+      ASSERT_TRUE(it == big.end());
+    } else {
+      ASSERT_EQ(*it, expected_it->second);
+    }
+    ASSERT_EQ(big.size(), expected.size());
+  }
+}
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "s21_parallel.h"
+
+namespace {
+// A pool of four threads and a small grain, so that even short inputs are
+// split into many chunks and every algorithm takes its parallel path.
+s21::parallel::thread_pool &pool() {
+  static s21::parallel::thread_pool pool(4);
+  return pool;
+}
+
+const s21::parallel::options kOpts{&pool(), 100};
+
+s21::vector<int> random_ints(std::size_t n) {
+  std::mt19937 gen(42);
+  s21::vector<int> v(n);
+  for (std::size_t i = 0; i < n; i++) v[i] = static_cast<int>(gen() % 1000);
+  return v;
+}
+}  // namespace
+
+TEST(test_parallel, pool_size) {
+  s21::parallel::thread_pool single(1);
+  ASSERT_EQ(single.size(), 1);
+  ASSERT_EQ(pool().size(), 4);
+  ASSERT_EQ(s21::parallel::default_pool().size(),
+            s21::parallel::thread_pool::default_threads());
+  int ran = 0;
+  single.submit([&] { ran++; });
+  ASSERT_EQ(ran, 1);
+}
+
+TEST(test_parallel, sort) {
+  for (std::size_t n : {0, 1, 99, 100, 101, 1234, 5000}) {
+    s21::vector<int> v = random_ints(n);
+    std::vector<int> expected(v.begin(), v.end());
+    std::sort(expected.begin(), expected.end());
+    s21::parallel::sort(v, std::less<>(), kOpts);
+    ASSERT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+    s21::parallel::sort(v, std::greater<>(), kOpts);
+    ASSERT_TRUE(std::equal(v.begin(), v.end(), expected.rbegin()));
+  }
+  s21::vector<int> v = random_ints(3000);
+  s21::parallel::sort(v);
+  ASSERT_TRUE(std::is_sorted(v.begin(), v.end()));
+}
+
+TEST(test_parallel, stable_sort) {
+  s21::vector<int> keys = random_ints(2000);
+  s21::vector<std::pair<int, int>> v;
+  for (std::size_t i = 0; i < keys.size(); i++) {
+    v.push_back({keys[i] % 10, static_cast<int>(i)});
+  }
+  std::vector<std::pair<int, int>> expected(v.begin(), v.end());
+  auto by_key = [](const auto &a, const auto &b) { return a.first < b.first; };
+  std::stable_sort(expected.begin(), expected.end(), by_key);
+  s21::parallel::stable_sort(v, by_key, kOpts);
+  ASSERT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+}
+
+TEST(test_parallel, for_each) {
+  s21::vector<int> v(1000, 1);
+  s21::parallel::for_each(v, [](int &x) { x *= 3; }, kOpts);
+  ASSERT_EQ(std::count(v.begin(), v.end(), 3), 1000);
+  s21::parallel::for_each(v.data() + 500, v.data() + 1000,
+                          [](int &x) { x = 0; }, kOpts);
+  ASSERT_EQ(std::count(v.begin(), v.end(), 0), 500);
+}
+
+TEST(test_parallel, transform) {
+  s21::vector<int> in = random_ints(1000);
+  s21::vector<double> out(1000);
+  s21::parallel::transform(in, out, [](int x) { return x * 0.5; }, kOpts);
+  for (std::size_t i = 0; i < in.size(); i++) ASSERT_EQ(out[i], in[i] * 0.5);
+
+  s21::parallel::transform(in, in, [](int x) { return -x; }, kOpts);
+  for (std::size_t i = 0; i < in.size(); i++) ASSERT_EQ(out[i], in[i] * -0.5);
+
+  s21::vector<double> short_out(999);
+  ASSERT_THROW(
+      s21::parallel::transform(in, short_out, [](int x) { return x; }, kOpts),
+      std::length_error);
+}
+
+TEST(test_parallel, reduce) {
+  s21::vector<int> v = random_ints(5000);
+  ASSERT_EQ(s21::parallel::reduce(v, 0LL, std::plus<>(), kOpts),
+            std::accumulate(v.begin(), v.end(), 0LL));
+  ASSERT_EQ(s21::parallel::reduce(v, 7LL), std::accumulate(v.begin(),
+                                                           v.end(), 7LL));
+  ASSERT_EQ(s21::parallel::reduce(s21::vector<int>(), 5), 5);
+
+  // Concatenation is associative but not commutative, so the chunks must
+  // be combined in order.
+  s21::vector<std::string> words(750);
+  std::string expected = ">";
+  for (std::size_t i = 0; i < words.size(); i++) {
+    words[i] = std::to_string(i % 10);
+    expected += words[i];
+  }
+  ASSERT_EQ(s21::parallel::reduce(words, std::string(">"), std::plus<>(),
+                                  s21::parallel::options{&pool(), 16}),
+            expected);
+}
+
+TEST(test_parallel, inclusive_scan) {
+  for (std::size_t n : {0, 1, 100, 101, 1234}) {
+    s21::vector<int> v = random_ints(n);
+    std::vector<long long> expected(n);
+    std::partial_sum(v.begin(), v.end(), expected.begin(),
+                     [](long long a, long long b) { return a + b; });
+    s21::vector<long long> out(n);
+    s21::parallel::inclusive_scan(v, out, std::plus<>(), kOpts);
+    ASSERT_TRUE(std::equal(out.begin(), out.end(), expected.begin()));
+
+    s21::parallel::inclusive_scan(v, v, std::plus<>(), kOpts);
+    ASSERT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+  }
+  s21::vector<std::string> letters(300, "a");
+  s21::parallel::inclusive_scan(letters, letters, std::plus<>(),
+                                s21::parallel::options{&pool(), 7});
+  for (std::size_t i = 0; i < letters.size(); i++) {
+    ASSERT_EQ(letters[i], std::string(i + 1, 'a'));
+  }
+}
+
+TEST(test_parallel, array) {
+  s21::array<int, 500> arr;
+  for (std::size_t i = 0; i < arr.size(); i++) {
+    arr[i] = static_cast<int>(arr.size() - i);
+  }
+  s21::parallel::sort(arr, std::less<>(), kOpts);
+  for (std::size_t i = 0; i < arr.size(); i++) {
+    ASSERT_EQ(arr[i], static_cast<int>(i + 1));
+  }
+  ASSERT_EQ(s21::parallel::reduce(arr, 0, std::plus<>(), kOpts), 125250);
+  s21::array<int, 500> sums;
+  s21::parallel::inclusive_scan(arr, sums, std::plus<>(), kOpts);
+  ASSERT_EQ(sums[499], 125250);
+}
+
+TEST(test_parallel, exception_is_rethrown) {
+  s21::vector<int> v(1000, 1);
+  auto fail_once = [&v](int &x) {
+    if (&x == &v[777]) throw std::runtime_error("boom");
+  };
+  ASSERT_THROW(s21::parallel::for_each(v, fail_once, kOpts),
+               std::runtime_error);
+  // The pool is still usable afterwards.
+  s21::parallel::for_each(v, [](int &x) { x = 5; }, kOpts);
+  ASSERT_EQ(std::count(v.begin(), v.end(), 5), 1000);
+}
+
+TEST(test_parallel, nested) {
+  s21::vector<s21::vector<int>> rows(8, random_ints(500));
+  s21::parallel::for_each(
+      rows,
+      [](s21::vector<int> &row) {
+        s21::parallel::sort(row, std::less<>(), kOpts);
+      },
+      s21::parallel::options{&pool(), 1});
+  for (const auto &row : rows) {
+    ASSERT_TRUE(std::is_sorted(row.begin(), row.end()));
+  }
+}
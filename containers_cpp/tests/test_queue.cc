@@ -114,3 +114,11 @@ TEST(test_queue, insert_many_back) {
   ASSERT_EQ(queue.front(), 1);
   queue.pop();
 }
+
+TEST(test_queue, allocator_goes_to_container) {
+  std::allocator<int> alloc;
+  s21::queue<int> queue(alloc);
+  ASSERT_TRUE(queue.empty());
+  s21::queue<int> filled({1, 2, 3}, alloc);
+  ASSERT_EQ(filled.back(), 3);
+}
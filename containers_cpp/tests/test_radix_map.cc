@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+
+#include "../src/s21_radix_map.h"
+
+TEST(test_radix_map, create_default) {
+  s21::radix_map<std::uint64_t, int> m;
+  ASSERT_TRUE(m.empty());
+  ASSERT_TRUE(m.begin() == m.end());
+  ASSERT_FALSE(m.contains(0));
+  ASSERT_TRUE(m.lower_bound(0) == m.end());
+  ASSERT_THROW(m.at(1), std::out_of_range);
+}
+
+TEST(test_radix_map, insert_find_erase) {
+  s21::radix_map<std::uint64_t, int> m({{5, 50}, {1, 10}, {300, 3}});
+  ASSERT_EQ(m.size(), 3);
+  ASSERT_FALSE(m.insert(5, 51).second);
+  ASSERT_EQ(m.at(5), 50);
+  ASSERT_FALSE(m.insert_or_assign(5, 52).second);
+  ASSERT_EQ(*m.find(5), 52);
+  m[7] = 70;
+  ASSERT_EQ(m.at(7), 70);
+  ASSERT_TRUE(m.find(8) == m.end());
+  ASSERT_EQ(m.erase(8), 0);
+  ASSERT_EQ(m.erase(1), 1);
+  ASSERT_FALSE(m.contains(1));
+  ASSERT_EQ(m.size(), 3);
+}
+
+TEST(test_radix_map, signed_keys_are_ordered) {
+  s21::radix_map<int, int> m;
+  int keys[] = {5, -1, 0, -300, 1 << 30, -(1 << 30), 7};
+  for (int key : keys) m.insert(key, key);
+  int prev = -(1 << 30) - 1;
+  std::size_t n = 0;
+  for (auto it = m.begin(); it != m.end(); ++it, n++) {
+    ASSERT_LT(prev, it.get_key());
+    ASSERT_EQ(*it, it.get_key());
+    prev = it.get_key();
+  }
+  ASSERT_EQ(n, 7);
+  auto it = m.end();
+  --it;
+  ASSERT_EQ(it.get_key(), 1 << 30);
+  ASSERT_EQ(m.lower_bound(-2).get_key(), -1);
+  ASSERT_EQ(m.upper_bound(0).get_key(), 5);
+}
+
+TEST(test_radix_map, string_keys) {
+  s21::radix_map<std::string, int> m;
+  const char *words[] = {"romane", "romanus", "romulus", "rubens", "ruber",
+                         "rubicon", "rubicundus", "r", "", "rom"};
+  int i = 0;
+  for (const char *word : words) m.insert(word, i++);
+  ASSERT_EQ(m.size(), 10);
+  for (i = 0; i < 10; i++) ASSERT_EQ(m.at(words[i]), i);
+  ASSERT_FALSE(m.contains("roman"));
+  ASSERT_FALSE(m.contains("rubiconx"));
+  std::string prev;
+  auto it = m.begin();
+  ASSERT_EQ(it.get_key(), "");
+  for (++it; it != m.end(); ++it) {
+    ASSERT_LT(prev, it.get_key());
+    prev = it.get_key();
+  }
+  ASSERT_EQ(m.lower_bound("roman").get_key(), "romane");
+  ASSERT_EQ(m.lower_bound("rubicp").get_key(), "rubicundus");
+  ASSERT_TRUE(m.lower_bound("rubicz") == m.end());
+  ASSERT_TRUE(m.lower_bound("s") == m.end());
+  ASSERT_EQ(m.upper_bound("rubens").get_key(), "ruber");
+}
+
+TEST(test_radix_map, long_common_prefixes) {
+  s21::radix_map<std::string, int> m;
+  std::string base(40, 'x');
+  for (int i = 0; i < 20; i++) {
+    m.insert(base + std::to_string(i), i);
+    m.insert(base.substr(0, 20) + "y" + std::to_string(i), -i);
+  }
+  ASSERT_EQ(m.size(), 40);
+  ASSERT_EQ(m.at(base + "13"), 13);
+  ASSERT_EQ(m.at(base.substr(0, 20) + "y13"), -13);
+  ASSERT_FALSE(m.contains(base.substr(0, 30) + "z"));
+  ASSERT_EQ(m.lower_bound(base.substr(0, 30)).get_key(), base + "0");
+  ASSERT_EQ(m.lower_bound(base + "z").get_key(), base.substr(0, 20) + "y0");
+  for (int i = 0; i < 20; i++) {
+    ASSERT_EQ(m.erase(base + std::to_string(i)), 1);
+  }
+  ASSERT_EQ(m.size(), 20);
+  ASSERT_EQ(m.at(base.substr(0, 20) + "y7"), -7);
+}
+
+TEST(test_radix_map, copy_and_move) {
+  s21::radix_map<std::uint32_t, int> m({{1, 1}, {2, 2}, {3, 3}});
+  s21::radix_map<std::uint32_t, int> copy(m);
+  copy.erase(2);
+  ASSERT_TRUE(m.contains(2));
+  s21::radix_map<std::uint32_t, int> moved(std::move(copy));
+  ASSERT_TRUE(copy.empty());
+  ASSERT_TRUE(copy.begin() == copy.end());
+  ASSERT_EQ(moved.size(), 2);
+  ASSERT_EQ(moved.begin().get_key(), 1);
+  ASSERT_EQ((--moved.end()).get_key(), 3);
+  m = moved;
+  ASSERT_EQ(m.size(), 2);
+}
+
+TEST(test_radix_map, for_each_and_erase_iterator) {
+  s21::radix_map<int, int> m;
+  for (int i = 0; i < 10; i++) m.insert(i, i);
+  auto it = m.erase(m.find(3));
+  ASSERT_EQ(it.get_key(), 4);
+  int sum = 0;
+  m.for_each([&sum](const int &key, const int &) {
+    sum += key;
+    return key < 5;
+  });
+  ASSERT_EQ(sum, 0 + 1 + 2 + 4 + 5);
+}
+
+// Grows and shrinks every node type.
+TEST(test_radix_map, random_operations) {
+  s21::radix_map<std::uint64_t, int> m;
+  std::map<std::uint64_t, int> expected;
+  std::mt19937_64 gen(1);
+  for (int i = 0; i < 40000; i++) {
+    std::uint64_t key = gen() % 1024;
+    if (i % 3 == 0) key = gen();
+    if (i % 5 == 0) key = (gen() % 64) << 32 | (gen() % 300);
+    if (i < 20000 ? gen() % 4 != 0 : gen() % 4 == 0) {
+      ASSERT_EQ(m.insert(key, i).second, expected.emplace(key, i).second);
+    } else {
+      ASSERT_EQ(m.erase(key), expected.erase(key));
+    }
+    if (i % 100 == 0) {
+      std::uint64_t probe = gen() % 2048;
+      auto lb = m.lower_bound(probe);
+      auto expected_lb = expected.lower_bound(probe);
+      ASSERT_EQ(lb == m.end(), expected_lb == expected.end());
+      if (lb != m.end()) {
+        ASSERT_EQ(lb.get_key(), expected_lb->first);
+      }
+    }
+  }
+  ASSERT_EQ(m.size(), expected.size());
+  auto it = m.begin();
+  for (auto &entry : expected) {
+    ASSERT_EQ(it.get_key(), entry.first);
+    ASSERT_EQ(*it, entry.second);
+    ++it;
+  }
+  ASSERT_TRUE(it == m.end());
+}
+
+TEST(test_radix_map, random_string_operations) {
+  s21::radix_map<std::string, int> m;
+  std::map<std::string, int> expected;
+  std::mt19937 gen(2);
+  for (int i = 0; i < 20000; i++) {
+    std::string key(gen() % 6, 'a');
+    for (auto &c : key) c = static_cast<char>('a' + gen() % 3);
+    if (gen() % 3) {
+      ASSERT_EQ(m.insert(key, i).second, expected.emplace(key, i).second);
+    } else {
+      ASSERT_EQ(m.erase(key), expected.erase(key));
+    }
+    auto lb = m.lower_bound(key + "b");
+    auto expected_lb = expected.lower_bound(key + "b");
+    ASSERT_EQ(lb == m.end(), expected_lb == expected.end());
+    if (lb != m.end()) {
+      ASSERT_EQ(lb.get_key(), expected_lb->first);
+    }
+  }
+  auto it = m.begin();
+  for (auto &entry : expected) {
+    ASSERT_EQ(it.get_key(), entry.first);
+    ++it;
+  }
+  ASSERT_TRUE(it == m.end());
+}
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <list>
+#include <string>
+
 #include "../src/s21_set.h"
 
 TEST(test_set, create_default_set) {
@@ -783,3 +786,184 @@ TEST(test_set, is_greater_or_eq_false) {
   other.insert(3);
   ASSERT_FALSE(set >= other);
 }
+
+TEST(test_set, contains_many) {
+  s21::set<int> set;
+  for (int i = 0; i < 100; i += 2) {
+    set.insert(i);
+  }
+  int keys[40];
+  bool found[40];
+  for (int i = 0; i < 40; i++) {
+    keys[i] = i * 3;
+  }
+  bool *out = set.contains_many(keys, keys + 40, found);
+  ASSERT_EQ(out, found + 40);
+  for (int i = 0; i < 40; i++) {
+    ASSERT_EQ(found[i], set.contains(keys[i]));
+  }
+}
+
+TEST(test_set, contains_many_empty_set) {
+  s21::set<int> set;
+  int keys[] = {1, 2, 3};
+  bool found[] = {true, true, true};
+  set.contains_many(keys, keys + 3, found);
+  ASSERT_FALSE(found[0]);
+  ASSERT_FALSE(found[1]);
+  ASSERT_FALSE(found[2]);
+}
+
+TEST(test_set, find_many) {
+  s21::set<int> set({5, 1, 9, 3, 7});
+  int keys[] = {9, 4, 1, 7};
+  s21::set<int>::iterator found[4];
+  set.find_many(keys, keys + 4, found);
+  ASSERT_EQ(*found[0], 9);
+  ASSERT_TRUE(found[1] == set.end());
+  ASSERT_EQ(*found[2], 1);
+  ASSERT_EQ(*found[3], 7);
+}
+
+TEST(test_set, contains_many_list_keys) {
+  s21::set<std::string> set;
+  std::list<std::string> keys;
+  for (int i = 0; i < 40; i++) {
+    if (i % 3 == 0) set.insert(std::to_string(i));
+    keys.push_back(std::to_string(i));
+  }
+  bool found[40];
+  set.contains_many(keys.begin(), keys.end(), found);
+  for (int i = 0; i < 40; i++) ASSERT_EQ(found[i], i % 3 == 0);
+}
+
+TEST(test_set, avl_balance) {
+  s21::set<int, std::less<int>, std::allocator<int>, s21::avl_balance> set(
+      {4, 2, 6, 1, 3, 5, 7});
+  set.insert(8);
+  set.erase(2);
+  ASSERT_EQ(set.size(), 7);
+  ASSERT_FALSE(set.contains(2));
+  ASSERT_TRUE(set.contains(8));
+  int expected[] = {1, 3, 4, 5, 6, 7, 8};
+  int i = 0;
+  for (auto it = set.begin(); it != set.end(); ++it) {
+    ASSERT_EQ(*it, expected[i++]);
+  }
+}
+
+TEST(test_set, for_each) {
+  s21::set<int> set({5, 1, 9, 3, 7});
+  int expected[] = {1, 3, 5, 7, 9};
+  int i = 0;
+  set.for_each([&](int key) { ASSERT_EQ(key, expected[i++]); });
+  ASSERT_EQ(i, 5);
+}
+
+TEST(test_set, for_each_early_exit) {
+  s21::set<int> set({5, 1, 9, 3, 7});
+  int visited = 0;
+  set.for_each([&](int key) {
+    visited++;
+    return key < 5;
+  });
+  ASSERT_EQ(visited, 3);
+}
+
+TEST(test_set, for_each_in_range) {
+  s21::set<int> set;
+  for (int i = 0; i < 100; i++) set.insert(i);
+  int sum = 0, visited = 0;
+  set.for_each_in_range(10, 20, [&](int key) {
+    sum += key;
+    visited++;
+  });
+  ASSERT_EQ(visited, 10);
+  ASSERT_EQ(sum, 145);
+  visited = 0;
+  set.for_each_in_range(50, 50, [&](int) { visited++; });
+  set.for_each_in_range(200, 300, [&](int) { visited++; });
+  ASSERT_EQ(visited, 0);
+}
+
+TEST(test_set, copy_keys_to) {
+  s21::set<int> set({5, 1, 9, 3, 7});
+  s21::vector<int> keys({0});
+  set.copy_keys_to(keys);
+  ASSERT_EQ(keys.size(), 6);
+  int expected[] = {0, 1, 3, 5, 7, 9};
+  for (int i = 0; i < 6; i++) ASSERT_EQ(keys[i], expected[i]);
+}
+
+TEST(test_set, bloom_filter) {
+  s21::set<int> set;
+  for (int i = 0; i < 1000; i += 2) set.insert(i);
+  set.enable_bloom_filter(1 << 14);
+  for (int i = 0; i < 1000; i++) ASSERT_EQ(set.contains(i), i % 2 == 0);
+  s21::bloom_stats stats = set.get_bloom_stats();
+  ASSERT_EQ(stats.lookups, 1000);
+  ASSERT_EQ(stats.rejected + stats.false_positives, 500);
+  ASSERT_LT(stats.false_positive_rate(), 0.1);
+  set.insert(1001);
+  ASSERT_TRUE(set.contains(1001));
+  ASSERT_EQ(set.count(1001), 1);
+}
+
+TEST(test_set, bloom_filter_rebuild_after_erase) {
+  s21::set<int> set({1, 2, 3});
+  set.enable_bloom_filter(256);
+  set.erase(2);
+  ASSERT_FALSE(set.contains(2));
+  ASSERT_EQ(set.get_bloom_stats().erased_since_rebuild, 1);
+  set.rebuild_bloom_filter();
+  ASSERT_EQ(set.get_bloom_stats().erased_since_rebuild, 0);
+  ASSERT_TRUE(set.contains(1));
+  ASSERT_TRUE(set.contains(3));
+  s21::set<int> copy(set);
+  ASSERT_TRUE(copy.contains(3));
+  set.disable_bloom_filter();
+  ASSERT_EQ(set.get_bloom_stats().lookups, 0);
+  ASSERT_TRUE(set.contains(1));
+}
+
+TEST(test_set, bloom_filter_contains_many) {
+  s21::set<int> set;
+  for (int i = 0; i < 100; i += 4) set.insert(i);
+  set.enable_bloom_filter(1 << 12);
+  int keys[50];
+  bool found[50];
+  for (int i = 0; i < 50; i++) keys[i] = i * 2;
+  set.contains_many(keys, keys + 50, found);
+  for (int i = 0; i < 50; i++) ASSERT_EQ(found[i], keys[i] % 4 == 0);
+  ASSERT_EQ(set.get_bloom_stats().lookups, 50);
+}
+
+TEST(test_set, key_without_hash) {
+  // std::pair has no std::hash; a set that never enables the Bloom filter
+  // must not need one.
+  s21::set<std::pair<int, int>> set({{1, 2}, {0, 5}});
+  set.insert({1, 1});
+  ASSERT_TRUE(set.contains({1, 2}));
+  ASSERT_FALSE(set.contains({2, 1}));
+  s21::set<std::pair<int, int>> copy(set);
+  ASSERT_EQ(copy.size(), 3);
+  ASSERT_EQ(*copy.begin(), std::make_pair(0, 5));
+}
+
+TEST(test_set, merkle_diff) {
+  using merkle_set =
+      s21::set<int, std::less<int>, std::allocator<int>, s21::merkle<>>;
+  merkle_set a({1, 2, 3, 4, 5});
+  merkle_set b({5, 4, 3, 2, 6});
+  a.enable_merkle();
+  b.enable_merkle();
+  s21::vector<int> keys = a.diff(b);
+  ASSERT_EQ(keys.size(), 2);
+  ASSERT_EQ(keys[0], 1);
+  ASSERT_EQ(keys[1], 6);
+  b.erase(6);
+  b.insert(1);
+  ASSERT_EQ(a.merkle_hash(), b.merkle_hash());
+  ASSERT_TRUE(a == b);
+  ASSERT_EQ(a.diff(b).size(), 0);
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "s21_simd.h"
+
+namespace {
+using s21::simd::level;
+
+// Runs check once per level the CPU supports and restores the level.
+template <class Check>
+void for_each_level(Check check) {
+  level saved = s21::simd::active_level();
+  for (level l : {level::scalar, level::sse2, level::avx2}) {
+    if (l > s21::simd::detected_level()) break;
+    s21::simd::set_level(l);
+    check();
+  }
+  s21::simd::set_level(saved);
+}
+
+// Compares every kernel with the standard algorithms on all lengths up to
+// a few AVX2 registers and at every offset within one, so both the vector
+// loops and the scalar tails are covered.
+template <class T>
+void check_kernels() {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> dist(0, 3);
+  std::vector<T> a(160);
+  for (auto &x : a) x = static_cast<T>(dist(gen));
+  const T needle = static_cast<T>(2);
+  for_each_level([&] {
+    for (std::size_t offset = 0; offset < 32; offset += 3) {
+      for (std::size_t n = 0; offset + n <= a.size(); n += 7) {
+        const T *first = a.data() + offset;
+        std::vector<T> b(first, first + n);
+        ASSERT_EQ(s21::simd::mismatch(first, b.data(), n), n);
+        for (std::size_t i = 0; i < n; i += 5) {
+          b[i] = static_cast<T>(7);
+          ASSERT_EQ(s21::simd::mismatch(first, b.data(), n),
+                    static_cast<std::size_t>(std::mismatch(first, first + n,
+                                                           b.data())
+                                                 .first -
+                                             first));
+          b[i] = first[i];
+        }
+        ASSERT_EQ(s21::simd::find(first, n, needle),
+                  static_cast<std::size_t>(
+                      std::find(first, first + n, needle) - first));
+        ASSERT_EQ(s21::simd::count(first, n, needle),
+                  static_cast<std::size_t>(
+                      std::count(first, first + n, needle)));
+        s21::simd::fill(b.data(), n, needle);
+        ASSERT_EQ(std::count(b.begin(), b.end(), needle),
+                  static_cast<std::ptrdiff_t>(n));
+      }
+    }
+  });
+}
+}  // namespace
+
+TEST(test_simd, kernels_match_std) {
+  check_kernels<std::int8_t>();
+  check_kernels<std::uint8_t>();
+  check_kernels<std::int16_t>();
+  check_kernels<std::uint32_t>();
+  check_kernels<std::int64_t>();
+  check_kernels<float>();
+  check_kernels<double>();
+}
+
+TEST(test_simd, level_is_capped_by_cpu) {
+  level saved = s21::simd::set_level(level::avx2);
+  ASSERT_EQ(s21::simd::active_level(), s21::simd::detected_level());
+  s21::simd::set_level(level::scalar);
+  ASSERT_EQ(s21::simd::active_level(), level::scalar);
+  s21::simd::set_level(saved);
+}
+
+TEST(test_simd, int64_halves) {
+  // Equal low halves must not be mistaken for equal elements.
+  std::vector<std::int64_t> a(8, 1);
+  std::vector<std::int64_t> b(8, 1);
+  b[5] += std::int64_t{1} << 40;
+  for_each_level([&] {
+    ASSERT_EQ(s21::simd::mismatch(a.data(), b.data(), 8), 5);
+    ASSERT_EQ(s21::simd::find(b.data(), 8, b[5]), 5);
+  });
+}
+
+TEST(test_simd, floating_point_semantics) {
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  std::vector<double> a(40, 1.0);
+  std::vector<double> b(40, 1.0);
+  a[3] = 0.0;
+  b[3] = -0.0;
+  for_each_level([&] {
+    ASSERT_TRUE(s21::simd::equal(a.data(), b.data(), 40));
+    a[20] = b[20] = nan;
+    ASSERT_EQ(s21::simd::mismatch(a.data(), b.data(), 40), 20);
+    ASSERT_EQ(s21::simd::find(a.data(), 40, nan), 40);
+    // A NaN orders neither way, so the next difference decides.
+    ASSERT_FALSE(s21::simd::lexicographical_compare(a.data(), 40, b.data(),
+                                                    40));
+    b[30] = 2.0;
+    ASSERT_TRUE(s21::simd::lexicographical_compare(a.data(), 40, b.data(),
+                                                   40));
+    a[20] = b[20] = 1.0;
+    b[30] = 1.0;
+  });
+}
+
+TEST(test_simd, lexicographical_compare) {
+  std::vector<int> a(100, 5);
+  std::vector<int> b(100, 5);
+  for_each_level([&] {
+    ASSERT_FALSE(s21::simd::lexicographical_compare(a.data(), 100, b.data(),
+                                                    100));
+    ASSERT_TRUE(s21::simd::lexicographical_compare(a.data(), 99, b.data(),
+                                                   100));
+    b[70] = 4;
+    ASSERT_TRUE(s21::simd::lexicographical_compare(b.data(), 100, a.data(),
+                                                   100));
+    ASSERT_FALSE(s21::simd::lexicographical_compare(a.data(), 100, b.data(),
+                                                    100));
+    b[70] = 5;
+  });
+}
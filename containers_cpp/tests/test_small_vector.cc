@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+
+#include "s21_small_vector.h"
+
+namespace {
+struct Counted {
+  static inline int live = 0;
+  explicit Counted(int v) : value(v) { live++; }
+  Counted(const Counted &other) : value(other.value) { live++; }
+  Counted &operator=(const Counted &other) = default;
+  ~Counted() { live--; }
+  int value;
+};
+// Copies fail once the budget runs out; the move constructor may throw, so
+// relocation copies.
+struct Fragile {
+  static inline int budget = -1;
+  static inline int live = 0;
+  explicit Fragile(int v) : value(v) { live++; }
+  Fragile(const Fragile &other) : value(other.value) {
+    if (budget == 0) throw std::runtime_error("copy failed");
+    if (budget > 0) budget--;
+    live++;
+  }
+  Fragile(Fragile &&other) noexcept(false) : Fragile(other) {}
+  Fragile &operator=(const Fragile &other) = default;
+  ~Fragile() { live--; }
+  int value;
+};
+}  // namespace
+
+TEST(test_small_vector, stays_inline) {
+  s21::small_vector<int, 4> v;
+  ASSERT_TRUE(v.is_inline());
+  ASSERT_EQ(v.capacity(), 4);
+  const char *self = reinterpret_cast<const char *>(&v);
+  for (int i = 0; i < 4; i++) v.push_back(i);
+  const char *data = reinterpret_cast<const char *>(v.data());
+  ASSERT_TRUE(v.is_inline());
+  ASSERT_TRUE(data >= self && data < self + sizeof(v));
+
+  v.push_back(4);
+  ASSERT_FALSE(v.is_inline());
+  ASSERT_EQ(v.capacity(), 8);
+  for (int i = 0; i < 5; i++) ASSERT_EQ(v[i], i);
+
+  v.erase(v.begin() + 1, v.end());
+  v.shrink_to_fit();
+  ASSERT_TRUE(v.is_inline());
+  ASSERT_EQ(v.capacity(), 4);
+  ASSERT_EQ(v.front(), 0);
+}
+
+TEST(test_small_vector, constructors) {
+  s21::small_vector<std::string, 2> a{"a", "b", "c"};
+  ASSERT_EQ(a.size(), 3);
+  ASSERT_FALSE(a.is_inline());
+
+  s21::small_vector<std::string, 2> b(2, "x");
+  ASSERT_TRUE(b.is_inline());
+  ASSERT_EQ(b[1], "x");
+
+  s21::small_vector<int, 8> c(5);
+  ASSERT_EQ(c.size(), 5);
+  ASSERT_EQ(c.back(), 0);
+
+  s21::small_vector<std::string, 2> copy(a);
+  ASSERT_EQ(copy, a);
+  copy = b;
+  ASSERT_EQ(copy, b);
+  ASSERT_EQ(copy.capacity(), 4);
+  ASSERT_THROW(copy.at(2), std::out_of_range);
+}
+
+TEST(test_small_vector, move_and_swap) {
+  s21::small_vector<std::string, 2> inline_v{"a"};
+  s21::small_vector<std::string, 2> heap_v{"x", "y", "z"};
+  const std::string *heap_data = heap_v.data();
+
+  s21::small_vector<std::string, 2> moved(std::move(heap_v));
+  ASSERT_EQ(moved.data(), heap_data);
+  ASSERT_TRUE(heap_v.empty());
+  ASSERT_TRUE(heap_v.is_inline());
+
+  s21::small_vector<std::string, 2> moved_inline(std::move(inline_v));
+  ASSERT_EQ(moved_inline[0], "a");
+  ASSERT_TRUE(moved_inline.is_inline());
+  ASSERT_TRUE(inline_v.empty());
+
+  static_assert(noexcept(moved.swap(moved_inline)));
+  moved.swap(moved_inline);
+  ASSERT_EQ(moved.size(), 1);
+  ASSERT_EQ(moved[0], "a");
+  ASSERT_EQ(moved_inline.size(), 3);
+  ASSERT_EQ(moved_inline.data(), heap_data);
+
+  s21::small_vector<std::string, 2> other{"q", "r", "s", "t"};
+  other.swap(moved_inline);
+  ASSERT_EQ(other.data(), heap_data);
+  ASSERT_EQ(moved_inline.back(), "t");
+
+  moved = std::move(other);
+  ASSERT_EQ(moved.data(), heap_data);
+}
+
+TEST(test_small_vector, modifiers) {
+  s21::small_vector<int, 4> v{1, 5};
+  v.insert(v.cbegin() + 1, {2, 3, 4});
+  ASSERT_EQ(v.size(), 5);
+  for (int i = 0; i < 5; i++) ASSERT_EQ(v[i], i + 1);
+
+  v.emplace(v.cbegin(), 0);
+  v.emplace_back(6);
+  v.insert(v.cend(), 2, 7);
+  v.insert_many_back(8, 9);
+  ASSERT_EQ(v.size(), 11);
+  ASSERT_EQ(v[6], 6);
+  ASSERT_EQ(v[8], 7);
+  ASSERT_EQ(v.back(), 9);
+
+  v.erase(v.begin());
+  v.pop_back();
+  v.resize(3);
+  s21::small_vector<int, 4> expected{1, 2, 3};
+  ASSERT_EQ(v, expected);
+
+  v.resize(6, 9);
+  ASSERT_EQ(v[5], 9);
+  v.assign(2, v[5]);
+  ASSERT_EQ(v.size(), 2);
+  ASSERT_EQ(v[1], 9);
+  v.clear();
+  ASSERT_TRUE(v.empty());
+}
+
+TEST(test_small_vector, element_lifetimes) {
+  {
+    s21::small_vector<Counted, 3> v;
+    for (int i = 0; i < 3; i++) v.emplace_back(i);
+    ASSERT_EQ(Counted::live, 3);
+    v.emplace_back(3);
+    ASSERT_EQ(Counted::live, 4);
+    v.erase(v.begin(), v.begin() + 2);
+    ASSERT_EQ(Counted::live, 2);
+    v.shrink_to_fit();
+    ASSERT_EQ(Counted::live, 2);
+    ASSERT_TRUE(v.is_inline());
+    ASSERT_EQ(v[0].value, 2);
+
+    s21::small_vector<Counted, 3> other(std::move(v));
+    ASSERT_EQ(Counted::live, 2);
+    other.insert(other.cbegin(), 3, Counted(9));
+    ASSERT_EQ(Counted::live, 5);
+  }
+  ASSERT_EQ(Counted::live, 0);
+}
+
+TEST(test_small_vector, comparison) {
+  s21::small_vector<int, 2> a{1, 2, 3};
+  s21::small_vector<int, 2> b{1, 2, 4};
+  s21::small_vector<int, 2> c{1, 2};
+  ASSERT_TRUE(a < b);
+  ASSERT_TRUE(c < a);
+  ASSERT_TRUE(b > a);
+  ASSERT_TRUE(a <= a);
+  ASSERT_TRUE(b >= a);
+  ASSERT_TRUE(a != b);
+  ASSERT_FALSE(a == c);
+  ASSERT_EQ(s21::find(a, 3) - a.begin(), 2);
+  ASSERT_TRUE(s21::find(c, 3) == c.end());
+  ASSERT_EQ(s21::count(b, 4), 1);
+}
+
+TEST(test_small_vector, failed_growth_leaves_vector_intact) {
+  Fragile::budget = -1;
+  Fragile::live = 0;
+  {
+    s21::small_vector<Fragile, 4> v;
+    for (int i = 0; i < 4; i++) v.emplace_back(i);
+    Fragile::budget = 2;
+    ASSERT_THROW(v.emplace_back(4), std::runtime_error);
+    Fragile::budget = 2;
+    ASSERT_THROW(v.insert(v.begin() + 1, Fragile(9)), std::runtime_error);
+    Fragile::budget = 10;
+    ASSERT_THROW(v.resize(12, Fragile(9)), std::runtime_error);
+    Fragile::budget = -1;
+    ASSERT_TRUE(v.is_inline());
+    ASSERT_EQ(v.size(), 4);
+    for (int i = 0; i < 4; i++) ASSERT_EQ(v[i].value, i);
+    ASSERT_EQ(Fragile::live, 4);
+  }
+  ASSERT_EQ(Fragile::live, 0);
+}
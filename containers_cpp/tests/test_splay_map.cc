@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include "../src/s21_splay_map.h"
+
+TEST(test_splay_map, create_from_ilist) {
+  s21::splay_map<int, char> m({std::make_pair(2, 'b'), std::make_pair(1, 'a'),
+                               std::make_pair(3, 'c')});
+  ASSERT_EQ(m.size(), 3);
+  ASSERT_TRUE(
+      (std::is_same_v<decltype(m)::balance_type, s21::splay_balance>));
+  ASSERT_EQ(m.at(1), 'a');
+  ASSERT_EQ(m.at(3), 'c');
+}
+
+TEST(test_splay_map, found_key_is_root) {
+  s21::splay_map<int, int> m;
+  for (int i = 0; i < 50; i++) {
+    m.insert(i, i * 2);
+  }
+  ASSERT_EQ(m[17], 34);
+  ASSERT_EQ(m.get_tree_ptr()->get_root()->key, 17);
+}
+
+TEST(test_splay_map, insert_or_assign) {
+  s21::splay_map<int, int> m;
+  m.insert(1, 1);
+  m.insert_or_assign(1, 10);
+  m.insert_or_assign(2, 20);
+  ASSERT_EQ(m.at(1), 10);
+  ASSERT_EQ(m.at(2), 20);
+}
+
+TEST(test_splay_map, erase) {
+  s21::splay_map<int, int> m;
+  for (int i = 0; i < 20; i++) {
+    m.insert(i, i);
+  }
+  for (int i = 0; i < 20; i += 2) {
+    m.erase(i);
+  }
+  ASSERT_EQ(m.size(), 10);
+  int expected = 1;
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    ASSERT_EQ(it.get_key(), expected);
+    expected += 2;
+  }
+}
+
+TEST(test_splay_map, move_assign) {
+  static_assert(std::is_nothrow_move_constructible_v<s21::splay_map<int, int>>);
+  static_assert(std::is_nothrow_move_assignable_v<s21::splay_map<int, int>>);
+  s21::splay_map<int, int> m({std::make_pair(1, 10), std::make_pair(2, 20)});
+  s21::splay_map<int, int> c;
+  const int* value = &m.get_tree_ptr()->get_root()->value;
+  c = std::move(m);
+  ASSERT_EQ(c.size(), 2);
+  ASSERT_TRUE(m.empty());
+  ASSERT_EQ(&c.get_tree_ptr()->get_root()->value, value);
+}
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+
+#include "../src/s21_splay_set.h"
+
+TEST(test_splay_set, create_default) {
+  s21::splay_set<int> s;
+  ASSERT_TRUE(s.empty());
+  ASSERT_TRUE(
+      (std::is_same_v<decltype(s)::balance_type, s21::splay_balance>));
+}
+
+TEST(test_splay_set, create_from_ilist) {
+  s21::splay_set<int> s({3, 1, 2});
+  ASSERT_EQ(s.size(), 3);
+  ASSERT_TRUE(s.contains(1));
+  ASSERT_TRUE(s.contains(2));
+  ASSERT_TRUE(s.contains(3));
+  ASSERT_FALSE(s.contains(4));
+}
+
+TEST(test_splay_set, inserted_key_is_root) {
+  s21::splay_set<int> s({5, 1, 9});
+  s.insert(4);
+  ASSERT_EQ(s.get_tree_ptr()->get_root()->key, 4);
+  ASSERT_EQ(s.get_tree_ptr()->get_root()->parent, nullptr);
+}
+
+TEST(test_splay_set, found_deep_key_is_root) {
+  s21::splay_set<int> s;
+  for (int i = 0; i < 100; i++) {
+    s.insert(i);
+  }
+  ASSERT_TRUE(s.contains(0));
+  ASSERT_EQ(s.get_tree_ptr()->get_root()->key, 0);
+  ASSERT_EQ(*s.find(60), 60);
+  ASSERT_EQ(s.get_tree_ptr()->get_root()->key, 60);
+}
+
+TEST(test_splay_set, const_lookup_keeps_shape) {
+  s21::splay_set<int> s;
+  for (int i = 0; i < 100; i++) {
+    s.insert(i);
+  }
+  const s21::splay_set<int>& cs = s;
+  ASSERT_TRUE(cs.contains(0));
+  ASSERT_EQ(*cs.find(1), 1);
+  ASSERT_EQ(cs.count(2), 1);
+  ASSERT_EQ(s.get_tree_ptr()->get_root()->key, 99);
+}
+
+TEST(test_splay_set, found_shallow_key_stays) {
+  s21::splay_set<int> s({5, 1, 9});
+  ASSERT_TRUE(s.contains(5));
+  ASSERT_EQ(s.get_tree_ptr()->get_root()->key, 9);
+}
+
+TEST(test_splay_set, copy) {
+  s21::splay_set<int> s({1, 2, 3});
+  s21::splay_set<int> c(s);
+  ASSERT_EQ(c.size(), 3);
+  ASSERT_TRUE(
+      (std::is_same_v<decltype(c)::balance_type, s21::splay_balance>));
+  ASSERT_TRUE(c.contains(2));
+}
+
+TEST(test_splay_set, move) {
+  s21::splay_set<int> s({1, 2, 3});
+  s21::splay_set<int> c(std::move(s));
+  ASSERT_EQ(c.size(), 3);
+  ASSERT_TRUE(
+      (std::is_same_v<decltype(c)::balance_type, s21::splay_balance>));
+  ASSERT_TRUE(s.empty());
+}
+
+TEST(test_splay_set, move_assign) {
+  static_assert(std::is_nothrow_move_constructible_v<s21::splay_set<int>>);
+  static_assert(std::is_nothrow_move_assignable_v<s21::splay_set<int>>);
+  s21::splay_set<int> s({1, 2, 3});
+  s21::splay_set<int> c({7});
+  const int* root = &s.get_tree_ptr()->get_root()->key;
+  c = std::move(s);
+  ASSERT_EQ(c.size(), 3);
+  ASSERT_TRUE(s.empty());
+  ASSERT_EQ(&c.get_tree_ptr()->get_root()->key, root);
+}
+
+TEST(test_splay_set, erase_last_element) {
+  s21::splay_set<int> s({1});
+  s.erase(1);
+  ASSERT_TRUE(s.empty());
+  s.insert(2);
+  ASSERT_TRUE(s.contains(2));
+}
+
+TEST(test_splay_set, iterate_after_lookups) {
+  s21::splay_set<int> s({4, 2, 6, 1, 3, 5, 7});
+  int expected = 1;
+  for (auto it = s.begin(); it != s.end(); ++it) {
+    ASSERT_TRUE(s.contains(8 - expected));
+    ASSERT_EQ(*it, expected);
+    expected++;
+  }
+  ASSERT_EQ(expected, 8);
+}
+
+TEST(test_splay_set, random_operations) {
+  s21::splay_set<int> s;
+  std::set<int> expected;
+  std::mt19937 gen(1);
+  for (int i = 0; i < 2000; i++) {
+    int key = static_cast<int>(gen() % 300);
+    switch (gen() % 3) {
+      case 0:
+        s.insert(key);
+        expected.insert(key);
+        break;
+      case 1:
+        s.erase(key);
+        expected.erase(key);
+        break;
+      default:
+        ASSERT_EQ(s.contains(key), expected.count(key) == 1);
+    }
+  }
+  ASSERT_EQ(s.size(), expected.size());
+  auto it = s.begin();
+  for (int key : expected) {
+    ASSERT_EQ(*it, key);
+    ++it;
+  }
+  ASSERT_TRUE(it == s.end());
+}
+
+TEST(test_splay_set, sorted_inserts_build_deep_spine) {
+  // Ascending inserts leave a path as long as the set; copying, walking,
+  // compacting and freeing it must not recurse along that path.
+  const int kSize = 1000000;
+  s21::splay_set<int> s;
+  for (int i = 0; i < kSize; i++) s.insert(i);
+  s21::splay_set<int> copy(s);
+  ASSERT_EQ(copy.size(), kSize);
+  long long sum = 0;
+  copy.for_each([&sum](int key) { sum += key; });
+  ASSERT_EQ(sum, 1LL * kSize * (kSize - 1) / 2);
+  int in_range = 0;
+  copy.for_each_in_range(10, 20, [&in_range](int) { in_range++; });
+  ASSERT_EQ(in_range, 10);
+  copy.compact();
+  int expected = 0;
+  for (auto it = copy.begin(); it != copy.end(); ++it) {
+    ASSERT_EQ(*it, expected++);
+  }
+  ASSERT_EQ(expected, kSize);
+}
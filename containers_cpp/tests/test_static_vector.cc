@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#include <list>
+#include <sstream>
+#include <string>
+
+#include "s21_static_vector.h"
+
+namespace {
+struct Counted {
+  static inline int live = 0;
+  explicit Counted(int v) : value(v) { live++; }
+  Counted(const Counted &other) : value(other.value) { live++; }
+  Counted &operator=(const Counted &other) = default;
+  ~Counted() { live--; }
+  int value;
+};
+
+constexpr int constexpr_sum() {
+  s21::static_vector<int, 8> v{4, 9};
+  v.insert(v.begin(), 1);
+  v.push_back(16);
+  v.emplace(v.begin() + 2, 0);
+  v.erase(v.begin() + 2);
+  v.resize(5, 25);
+  int sum = 0;
+  for (int x : v) sum += x;
+  return sum;
+}
+
+static_assert(constexpr_sum() == 55);
+static_assert(s21::static_vector<int, 4>{1, 2} <
+              s21::static_vector<int, 4>{1, 3});
+static_assert(std::is_trivially_copyable_v<s21::static_vector<int, 4>>);
+}  // namespace
+
+TEST(test_static_vector, basics) {
+  s21::static_vector<int, 4> v;
+  ASSERT_TRUE(v.empty());
+  ASSERT_EQ(v.capacity(), 4);
+  v.push_back(1);
+  v.emplace_back(2);
+  v.insert(v.cbegin(), 0);
+  ASSERT_EQ(v.size(), 3);
+  ASSERT_EQ(v.front(), 0);
+  ASSERT_EQ(v.back(), 2);
+  ASSERT_EQ(v.at(1), 1);
+  ASSERT_THROW(v.at(3), std::out_of_range);
+  v.push_back(3);
+  ASSERT_TRUE(v.full());
+  const char *self = reinterpret_cast<const char *>(&v);
+  const char *data = reinterpret_cast<const char *>(v.data());
+  ASSERT_TRUE(data >= self && data < self + sizeof(v));
+}
+
+TEST(test_static_vector, overflow_throws_without_change) {
+  s21::static_vector<std::string, 3> v{"a", "b"};
+  v.push_back("c");
+  ASSERT_THROW(v.push_back("d"), std::length_error);
+  ASSERT_THROW(v.insert(v.cbegin(), "d"), std::length_error);
+  ASSERT_THROW(v.resize(4), std::length_error);
+  ASSERT_THROW(v.reserve(4), std::length_error);
+  v.pop_back();
+  std::list<std::string> two{"x", "y"};
+  ASSERT_THROW(v.insert(v.cbegin(), two.begin(), two.end()),
+               std::length_error);
+  ASSERT_THROW(v.assign(4, "z"), std::length_error);
+  ASSERT_THROW((v = {"w", "x", "y", "z"}), std::length_error);
+  ASSERT_THROW(v.assign({"w", "x", "y", "z"}), std::length_error);
+  ASSERT_EQ(v.size(), 2);
+  ASSERT_EQ(v[0], "a");
+  ASSERT_EQ(v[1], "b");
+  ASSERT_THROW((s21::static_vector<int, 2>{1, 2, 3}), std::length_error);
+}
+
+TEST(test_static_vector, insert_erase) {
+  s21::static_vector<std::string, 16> v{"a", "e"};
+  std::list<std::string> mid{"b", "c", "d"};
+  auto it = v.insert(v.cbegin() + 1, mid.begin(), mid.end());
+  ASSERT_EQ(*it, "b");
+  v.insert(v.cend(), 2, "f");
+  std::istringstream in("g h");
+  v.append(std::istream_iterator<std::string>(in),
+           std::istream_iterator<std::string>());
+  v.insert_many(v.cbegin(), "0");
+  s21::static_vector<std::string, 16> expected{"0", "a", "b", "c", "d",
+                                               "e", "f", "f", "g", "h"};
+  ASSERT_EQ(v, expected);
+
+  it = v.erase(v.cbegin(), v.cbegin() + 2);
+  ASSERT_EQ(*it, "b");
+  v.erase(v.cend() - 1);
+  ASSERT_EQ(v.size(), 7);
+  ASSERT_EQ(v.back(), "g");
+}
+
+TEST(test_static_vector, insert_nothing) {
+  s21::static_vector<std::string, 8> v{"alpha", "beta", "gamma"};
+  const s21::static_vector<std::string, 8> expected = v;
+  auto it = v.insert(v.cbegin() + 1, 0, "X");
+  ASSERT_EQ(*it, "beta");
+  std::list<std::string> empty;
+  it = v.insert(v.cbegin(), empty.begin(), empty.end());
+  ASSERT_EQ(*it, "alpha");
+  ASSERT_EQ(v, expected);
+}
+
+TEST(test_static_vector, element_lifetimes) {
+  {
+    s21::static_vector<Counted, 8> v;
+    for (int i = 0; i < 5; i++) v.emplace_back(i);
+    v.insert(v.cbegin() + 1, 2, Counted(9));
+    ASSERT_EQ(Counted::live, 7);
+    v.erase(v.cbegin(), v.cbegin() + 3);
+    ASSERT_EQ(Counted::live, 4);
+    ASSERT_EQ(v[0].value, 1);
+
+    s21::static_vector<Counted, 8> copy(v);
+    ASSERT_EQ(Counted::live, 8);
+    copy = s21::static_vector<Counted, 8>{Counted(7)};
+    ASSERT_EQ(Counted::live, 5);
+    copy.swap(v);
+    ASSERT_EQ(copy.size(), 4);
+    ASSERT_EQ(v[0].value, 7);
+
+    v.resize(3, Counted(2));
+    v.clear();
+    ASSERT_EQ(Counted::live, 4);
+  }
+  ASSERT_EQ(Counted::live, 0);
+}
+
+TEST(test_static_vector, comparison) {
+  s21::static_vector<int, 4> a{1, 2};
+  s21::static_vector<int, 4> b{1, 2, 0};
+  ASSERT_TRUE(a < b);
+  ASSERT_TRUE(a != b);
+  ASSERT_TRUE(b >= a);
+  b.pop_back();
+  ASSERT_EQ(a, b);
+  ASSERT_TRUE(a <= b);
+}
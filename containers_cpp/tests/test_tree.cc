@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <random>
+#include <set>
+
 #include "../src/s21_rbtree.h"
+#include "../src/s21_vector.h"
 
 TEST(test_rbtree, copy_node) {
   s21::Node<int, int> a(1, 2);
@@ -221,12 +225,15 @@ TEST(test_rbtree, extract_node_with_two_children_2) {
 
   tree.extract(30);
 
-  ASSERT_EQ(tree.get_root()->key, 10);
+  ASSERT_EQ(tree.get_root()->key, 20);
+  ASSERT_EQ(tree.get_root()->left->key, 5);
+  ASSERT_EQ(tree.get_root()->left->right->key, 10);
+  ASSERT_EQ(tree.get_root()->left->right->color, s21::BLACK);
   ASSERT_EQ(tree.get_root()->right->key, 38);
   ASSERT_EQ(tree.get_root()->right->right->key, 41);
   ASSERT_EQ(tree.get_root()->right->left->key, 32);
   ASSERT_EQ(tree.get_root()->right->left->right->key, 35);
-  ASSERT_EQ(tree.get_root()->right->left->right->color, s21::BLACK);
+  ASSERT_EQ(tree.get_root()->right->left->right->color, s21::RED);
   ASSERT_EQ(tree.size(), 9);
 }
 
@@ -512,4 +519,276 @@ TEST(test_rbtree, is_greater_or_eq_false) {
   tree.insert(2, 0);
   other.insert(3, 0);
   ASSERT_FALSE(tree >= other);
-}
\ No newline at end of file
+}
+namespace {
+// Returns the black height of the subtree, or -1 if it breaks a red-black
+// invariant.
+int rb_black_height(const s21::Node<int, int> *node,
+                    const s21::Node<int, int> *parent) {
+  if (node == nullptr) return 1;
+  if (node->parent != parent) return -1;
+  if (node->color == s21::RED &&
+      ((node->left && node->left->color == s21::RED) ||
+       (node->right && node->right->color == s21::RED)))
+    return -1;
+  int left = rb_black_height(node->left, node);
+  int right = rb_black_height(node->right, node);
+  if (left < 0 || left != right) return -1;
+  return left + (node->color == s21::BLACK);
+}
+
+// Height stored in a node of an avl_balance tree.
+int stored_height(const s21::Node<int, int> *node) {
+  return static_cast<const s21::AvlNode<int, int> *>(node)->height;
+}
+
+// Returns the height of the subtree, or -1 if it breaks an AVL invariant.
+int avl_height(const s21::Node<int, int> *node,
+               const s21::Node<int, int> *parent) {
+  if (node == nullptr) return 0;
+  if (node->parent != parent) return -1;
+  int left = avl_height(node->left, node);
+  int right = avl_height(node->right, node);
+  if (left < 0 || right < 0 || left - right > 1 || right - left > 1)
+    return -1;
+  int height = 1 + (left > right ? left : right);
+  return height == stored_height(node) ? height : -1;
+}
+
+template <class Tree, class Check>
+void random_operations(Tree &tree, Check check) {
+  std::set<int> expected;
+  std::mt19937 gen(1);
+  for (int i = 0; i < 5000; i++) {
+    int key = static_cast<int>(gen() % 500);
+    switch (gen() % 3) {
+      case 0:
+        tree.insert(key, 0);
+        expected.insert(key);
+        break;
+      case 1:
+        tree.erase(key);
+        expected.erase(key);
+        break;
+      default:
+        ASSERT_EQ(tree.contains(key), expected.count(key) == 1);
+    }
+    ASSERT_GE(check(tree.get_root()), 0);
+  }
+  ASSERT_EQ(tree.size(), expected.size());
+  auto it = tree.cbegin();
+  for (int key : expected) {
+    ASSERT_EQ(it.get_key(), key);
+    ++it;
+  }
+}
+}  // namespace
+
+TEST(test_rbtree, random_operations_keep_invariants) {
+  s21::tree<int, int> tree;
+  random_operations(tree, [](const s21::Node<int, int> *root) {
+    if (root && root->color != s21::BLACK) return -1;
+    return rb_black_height(root, nullptr);
+  });
+}
+
+TEST(test_avltree, insert_ascending) {
+  s21::tree<int, int, s21::avl_balance> tree;
+  for (int i = 1; i <= 7; i++) tree.insert(i, 0);
+  ASSERT_EQ(tree.get_root()->key, 4);
+  ASSERT_EQ(stored_height(tree.get_root()), 3);
+  ASSERT_EQ(tree.get_root()->left->key, 2);
+  ASSERT_EQ(tree.get_root()->right->key, 6);
+}
+
+TEST(test_avltree, insert_zig_zag) {
+  s21::tree<int, int, s21::avl_balance> tree;
+  tree.insert(30, 0);
+  tree.insert(10, 0);
+  tree.insert(20, 0);
+  ASSERT_EQ(tree.get_root()->key, 20);
+  ASSERT_EQ(tree.get_root()->left->key, 10);
+  ASSERT_EQ(tree.get_root()->right->key, 30);
+  ASSERT_EQ(stored_height(tree.get_root()), 2);
+}
+
+TEST(test_avltree, extract_rebalances) {
+  s21::tree<int, int, s21::avl_balance> tree;
+  tree.insert(20, 0);
+  tree.insert(10, 0);
+  tree.insert(30, 0);
+  tree.insert(40, 0);
+  auto node = tree.extract(10);
+  ASSERT_EQ(node.key, 10);
+  ASSERT_EQ(tree.size(), 3);
+  ASSERT_EQ(tree.get_root()->key, 30);
+  ASSERT_EQ(tree.get_root()->left->key, 20);
+  ASSERT_EQ(tree.get_root()->right->key, 40);
+}
+
+TEST(test_avltree, random_operations_keep_invariants) {
+  s21::tree<int, int, s21::avl_balance> tree;
+  random_operations(tree, [](const s21::Node<int, int> *root) {
+    return avl_height(root, nullptr);
+  });
+}
+
+TEST(test_rbtree, compact_keeps_shape_and_orders_nodes) {
+  s21::tree<int, int> tree;
+  std::mt19937 gen(3);
+  for (int i = 0; i < 300; i++) {
+    tree.insert(static_cast<int>(gen() % 1000), i);
+  }
+  s21::vector<int> before;
+  tree.for_each([&](const int &key, const int &) { before.push_back(key); });
+  int root_key = tree.get_root()->key;
+  int root_left_key = tree.get_root()->left->key;
+  tree.compact();
+  ASSERT_EQ(tree.get_root()->key, root_key);
+  ASSERT_EQ(tree.get_root()->left->key, root_left_key);
+  ASSERT_GE(rb_black_height(tree.get_root(), nullptr), 0);
+  auto it = tree.cbegin();
+  s21::Node<int, int> *first = it.get_pointer();
+  for (std::size_t i = 0; i < before.size(); i++, ++it) {
+    ASSERT_EQ(it.get_key(), before[i]);
+    ASSERT_EQ(it.get_pointer(), first + i);
+  }
+}
+
+TEST(test_rbtree, compact_then_update) {
+  s21::tree<int, int> tree;
+  std::set<int> expected;
+  std::mt19937 gen(5);
+  for (int round = 0; round < 3; round++) {
+    for (int i = 0; i < 500; i++) {
+      int key = static_cast<int>(gen() % 400);
+      if (gen() % 2) {
+        tree.insert(key, 0);
+        expected.insert(key);
+      } else {
+        tree.erase(key);
+        expected.erase(key);
+      }
+    }
+    tree.compact();
+    ASSERT_GE(rb_black_height(tree.get_root(), nullptr), 0);
+    ASSERT_EQ(tree.size(), expected.size());
+  }
+  auto it = tree.cbegin();
+  for (int key : expected) {
+    ASSERT_EQ(it.get_key(), key);
+    ++it;
+  }
+  tree.clear();
+  tree.compact();
+  ASSERT_TRUE(tree.empty());
+}
+
+namespace {
+// Returns false if a cached subtree hash differs from a fresh computation.
+// Stored is the node type the tree allocates.
+template <class Stored>
+bool merkle_consistent(const s21::Node<int, int> *node, std::size_t &hash) {
+  hash = 0;
+  if (node == nullptr) return true;
+  std::size_t left, right;
+  if (!merkle_consistent<Stored>(node->left, left) ||
+      !merkle_consistent<Stored>(node->right, right))
+    return false;
+  s21::tree<int, int, s21::merkle<>> single;
+  single.enable_merkle();
+  single.insert(node->key, node->value);
+  hash = left + right + single.merkle_hash();
+  return hash == static_cast<const Stored *>(node)->hash;
+}
+
+template <class Balance>
+void merkle_random_operations() {
+  using stored = s21::tree_node_t<int, int, s21::merkle<Balance>>;
+  s21::tree<int, int, s21::merkle<Balance>> tree;
+  tree.enable_merkle();
+  std::mt19937 gen(9);
+  for (int i = 0; i < 3000; i++) {
+    if (i == 1500) tree.compact();
+    if (i == 2000) {
+      tree.disable_merkle();
+      tree.enable_merkle();
+    }
+    int key = static_cast<int>(gen() % 200);
+    if (gen() % 3)
+      tree.insert(key, key * 3);
+    else
+      tree.erase(key);
+    tree.contains(static_cast<int>(gen() % 200));
+    std::size_t hash;
+    ASSERT_TRUE(merkle_consistent<stored>(tree.get_root(), hash));
+  }
+}
+}  // namespace
+
+TEST(test_rbtree, merkle_hashes_follow_updates) {
+  merkle_random_operations<s21::rb_balance>();
+  merkle_random_operations<s21::avl_balance>();
+  merkle_random_operations<s21::splay_balance>();
+}
+
+TEST(test_rbtree, merkle_hash_only_in_merkle_trees) {
+  static_assert(std::is_same_v<s21::tree_node_t<int, int, s21::rb_balance>,
+                               s21::Node<int, int>>);
+  static_assert(std::is_same_v<s21::tree_node_t<int, int, s21::merkle<>>,
+                               s21::HashedNode<s21::Node<int, int>>>);
+  ASSERT_LT(sizeof(s21::Node<int, int>),
+            sizeof(s21::HashedNode<s21::Node<int, int>>));
+}
+
+TEST(test_avltree, height_only_in_avl_trees) {
+  static_assert(std::is_same_v<s21::tree_node_t<int, int, s21::avl_balance>,
+                               s21::AvlNode<int, int>>);
+  static_assert(
+      std::is_same_v<s21::tree_node_t<int, int, s21::merkle<s21::avl_balance>>,
+                     s21::HashedNode<s21::AvlNode<int, int>>>);
+  static_assert(
+      std::is_same_v<s21::tree_node_t<int, int, s21::splay_balance>,
+                     s21::Node<int, int>>);
+  ASSERT_LT(sizeof(s21::Node<long, long>), sizeof(s21::AvlNode<long, long>));
+}
+
+TEST(test_rbtree, merkle_hash_independent_of_shape) {
+  s21::tree<int, int, s21::merkle<>> a, b;
+  a.enable_merkle();
+  b.enable_merkle();
+  for (int i = 0; i < 100; i++) {
+    a.insert(i, i);
+    b.insert(99 - i, 99 - i);
+  }
+  ASSERT_EQ(a.merkle_hash(), b.merkle_hash());
+  ASSERT_TRUE(a == b);
+  b.erase(50);
+  b.insert(50, 7);
+  ASSERT_NE(a.merkle_hash(), b.merkle_hash());
+  ASSERT_FALSE(a == b);
+}
+
+TEST(test_rbtree, merkle_diff) {
+  s21::tree<int, int, s21::merkle<>> a, b;
+  for (int i = 0; i < 1000; i++) {
+    a.insert(i, 0);
+    b.insert(999 - i, 0);
+  }
+  a.erase(10);
+  b.erase(500);
+  b.insert(1500, 0);
+  b.erase(700);
+  b.insert(700, 1);
+  int expected[] = {10, 500, 700, 1500};
+  for (bool merkle : {false, true}) {
+    if (merkle) {
+      a.enable_merkle();
+      b.enable_merkle();
+    }
+    s21::vector<int> keys;
+    a.diff(b, [&keys](int key) { keys.push_back(key); });
+    ASSERT_EQ(keys.size(), 4);
+    for (int i = 0; i < 4; i++) ASSERT_EQ(keys[i], expected[i]);
+  }
+}
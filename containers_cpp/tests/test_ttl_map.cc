@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <string>
+
+#include "../src/s21_ttl_map.h"
+
+namespace {
+using ttl_map = s21::ttl_map<int, std::string>;
+using seconds = std::chrono::seconds;
+const ttl_map::time_point t0;
+}  // namespace
+
+TEST(test_ttl_map, create) {
+  ttl_map m;
+  ASSERT_TRUE(m.empty());
+  ASSERT_EQ(m.find(1, t0), nullptr);
+  ASSERT_EQ(m.next_expiry(), ttl_map::time_point::max());
+  ASSERT_EQ(m.expire(t0), 0);
+}
+
+TEST(test_ttl_map, lookups_skip_expired) {
+  ttl_map m;
+  ASSERT_TRUE(m.insert(1, "one", seconds(10), t0));
+  ASSERT_FALSE(m.insert(1, "uno", seconds(10), t0 + seconds(5)));
+  ASSERT_EQ(*m.find(1, t0 + seconds(9)), "one");
+  ASSERT_TRUE(m.contains(1, t0 + seconds(9)));
+  ASSERT_FALSE(m.contains(1, t0 + seconds(10)));
+  ASSERT_THROW(m.at(1, t0 + seconds(10)), std::out_of_range);
+  ASSERT_EQ(m.size(), 1);
+  ASSERT_TRUE(m.insert(1, "uno", seconds(10), t0 + seconds(10)));
+  ASSERT_EQ(m.at(1, t0 + seconds(19)), "uno");
+  ASSERT_EQ(m.expires_at(1), t0 + seconds(20));
+}
+
+TEST(test_ttl_map, insert_or_assign) {
+  ttl_map m;
+  ASSERT_TRUE(m.insert_or_assign(1, "one", seconds(10), t0));
+  ASSERT_FALSE(m.insert_or_assign(1, "uno", seconds(10), t0 + seconds(5)));
+  ASSERT_EQ(m.expires_at(1), t0 + seconds(15));
+  ASSERT_EQ(m.expire(t0 + seconds(10)), 0);
+  ASSERT_TRUE(m.insert_or_assign(1, "eins", seconds(1), t0 + seconds(15)));
+  ASSERT_EQ(m.size(), 1);
+  ASSERT_EQ(m.expire(t0 + seconds(16)), 1);
+  ASSERT_TRUE(m.empty());
+}
+
+TEST(test_ttl_map, expire_removes_exactly_expired) {
+  ttl_map m;
+  for (int i = 0; i < 10; i++) {
+    m.insert(i, std::to_string(i), seconds(10 - i), t0);
+  }
+  ASSERT_EQ(m.next_expiry(), t0 + seconds(1));
+  ASSERT_EQ(m.expire(t0 + seconds(3)), 3);
+  ASSERT_EQ(m.size(), 7);
+  ASSERT_FALSE(m.contains(7, t0));
+  ASSERT_TRUE(m.contains(6, t0));
+  ASSERT_EQ(m.next_expiry(), t0 + seconds(4));
+  ASSERT_EQ(m.expire(t0 + seconds(100)), 7);
+  ASSERT_TRUE(m.empty());
+}
+
+TEST(test_ttl_map, touch_and_erase) {
+  ttl_map m;
+  m.insert(1, "one", seconds(10), t0);
+  m.insert(2, "two", seconds(10), t0);
+  ASSERT_TRUE(m.touch(1, seconds(10), t0 + seconds(5)));
+  ASSERT_FALSE(m.touch(3, seconds(10), t0));
+  ASSERT_FALSE(m.touch(2, seconds(10), t0 + seconds(10)));
+  ASSERT_EQ(m.expire(t0 + seconds(10)), 1);
+  ASSERT_TRUE(m.contains(1, t0 + seconds(10)));
+  ASSERT_TRUE(m.erase(1));
+  ASSERT_FALSE(m.erase(1));
+  ASSERT_TRUE(m.empty());
+  ASSERT_EQ(m.next_expiry(), ttl_map::time_point::max());
+}
+
+TEST(test_ttl_map, for_each_skips_expired) {
+  ttl_map m;
+  for (int i = 0; i < 6; i++) m.insert(i, "", seconds(i % 2 ? 10 : 1), t0);
+  int sum = 0;
+  m.for_each([&sum](const int &key, const std::string &) { sum += key; },
+             t0 + seconds(1));
+  ASSERT_EQ(sum, 1 + 3 + 5);
+  int visited = 0;
+  m.for_each(
+      [&visited](const int &, const std::string &) { return ++visited < 2; },
+      t0 + seconds(1));
+  ASSERT_EQ(visited, 2);
+}
+
+TEST(test_ttl_map, random_operations) {
+  s21::ttl_map<int, int> m;
+  std::map<int, std::pair<int, int>> expected;
+  std::mt19937 gen(1);
+  auto at = [](int t) {
+    return s21::ttl_map<int, int>::time_point(seconds(t));
+  };
+  for (int now = 0; now < 3000; now++) {
+    int key = static_cast<int>(gen() % 200);
+    int ttl = static_cast<int>(gen() % 50) + 1;
+    auto found = expected.find(key);
+    bool live = found != expected.end() && now < found->second.second;
+    switch (gen() % 4) {
+      case 0:
+        ASSERT_EQ(m.insert(key, now, seconds(ttl), at(now)), !live);
+        if (!live) expected[key] = std::make_pair(now, now + ttl);
+        break;
+      case 1:
+        ASSERT_EQ(m.insert_or_assign(key, now, seconds(ttl), at(now)), !live);
+        expected[key] = std::make_pair(now, now + ttl);
+        break;
+      case 2:
+        ASSERT_EQ(m.erase(key), found != expected.end());
+        if (found != expected.end()) expected.erase(found);
+        break;
+      default:
+        if (live) {
+          ASSERT_EQ(*m.find(key, at(now)), found->second.first);
+        } else {
+          ASSERT_EQ(m.find(key, at(now)), nullptr);
+        }
+    }
+    if (now % 10 == 0) {
+      std::size_t n = 0;
+      for (auto it = expected.begin(); it != expected.end();) {
+        if (it->second.second <= now) {
+          it = expected.erase(it);
+          n++;
+        } else {
+          ++it;
+        }
+      }
+      ASSERT_EQ(m.expire(at(now)), n);
+      ASSERT_EQ(m.size(), expected.size());
+    }
+  }
+}
@@ -1,5 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <iterator>
+#include <list>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
 #include <vector>
 
 #include "s21_vector.h"
@@ -463,15 +470,15 @@ TEST(test_vector, pop_back) {
 
   v.pop_back();
   ASSERT_EQ(v.size(), 2);
-  ASSERT_EQ(v.capacity(), 2);
+  ASSERT_EQ(v.capacity(), 4);
 
   v.pop_back();
   ASSERT_EQ(v.size(), 1);
-  ASSERT_EQ(v.capacity(), 1);
+  ASSERT_EQ(v.capacity(), 4);
 
   v.pop_back();
   ASSERT_EQ(v.size(), 0);
-  ASSERT_EQ(v.capacity(), 0);
+  ASSERT_EQ(v.capacity(), 4);
 }
 
 TEST(test_vector, resize) {
@@ -490,14 +497,526 @@ TEST(test_vector, resize) {
   ASSERT_EQ(v.front(), 1);
   ASSERT_EQ(v.back(), 0);
 
-  ASSERT_EQ(v.capacity(), 4);
+  ASSERT_EQ(v.capacity(), 8);
   ASSERT_EQ(v.size(), 4);
 
   v.resize(0);
-  ASSERT_EQ(v.capacity(), 4);
+  ASSERT_EQ(v.capacity(), 8);
   ASSERT_EQ(v.size(), 0);
 }
 
+namespace {
+// Counts live objects to check that the vector constructs and destroys
+// exactly the elements in [0, size()).
+struct Tracked {
+  static inline int live = 0;
+  explicit Tracked(int v) : value(v) { live++; }
+  Tracked(const Tracked &other) : value(other.value) { live++; }
+  Tracked &operator=(const Tracked &other) = default;
+  ~Tracked() { live--; }
+  int value;
+};
+}  // namespace
+
+TEST(test_vector, reserve_constructs_nothing) {
+  {
+    s21::vector<Tracked> v;
+    v.reserve(1000);
+    ASSERT_EQ(Tracked::live, 0);
+    ASSERT_EQ(v.size(), 0);
+
+    v.push_back(Tracked(1));
+    v.push_back(Tracked(2));
+    v.push_back(Tracked(3));
+    ASSERT_EQ(Tracked::live, 3);
+  }
+  ASSERT_EQ(Tracked::live, 0);
+}
+
+TEST(test_vector, modifiers_destroy_elements) {
+  {
+    s21::vector<Tracked> v;
+    for (int i = 0; i < 10; i++) v.push_back(Tracked(i));
+    ASSERT_EQ(Tracked::live, 10);
+
+    v.pop_back();
+    ASSERT_EQ(Tracked::live, 9);
+
+    v.erase(v.begin());
+    ASSERT_EQ(Tracked::live, 8);
+    ASSERT_EQ(v.front().value, 1);
+
+    v.erase(v.begin() + 2, v.begin() + 5);
+    ASSERT_EQ(Tracked::live, 5);
+    ASSERT_EQ(v[2].value, 6);
+
+    v.resize(2, Tracked(0));
+    ASSERT_EQ(Tracked::live, 2);
+
+    v.insert(v.begin() + 1, 3, Tracked(7));
+    ASSERT_EQ(Tracked::live, 5);
+    ASSERT_EQ(v[1].value, 7);
+    ASSERT_EQ(v[4].value, 2);
+
+    v.clear();
+    ASSERT_EQ(Tracked::live, 0);
+    ASSERT_TRUE(v.empty());
+  }
+  ASSERT_EQ(Tracked::live, 0);
+}
+
+TEST(test_vector, non_default_constructible) {
+  s21::vector<Tracked> v{Tracked(1), Tracked(2)};
+  v.push_back(v[0]);
+  v.resize(5, Tracked(4));
+  s21::vector<Tracked> c(v);
+
+  ASSERT_EQ(c.size(), 5);
+  ASSERT_EQ(c[2].value, 1);
+  ASSERT_EQ(c[4].value, 4);
+}
+
+TEST(test_vector, resize_default_init) {
+  s21::vector<int> v{1, 2};
+  v.resize_default_init(100);
+  ASSERT_EQ(v.size(), 100);
+  ASSERT_EQ(v[1], 2);
+  for (int i = 2; i < 100; i++) v[i] = i;
+  ASSERT_EQ(v.back(), 99);
+
+  v.resize_default_init(1);
+  ASSERT_EQ(v.size(), 1);
+  ASSERT_EQ(v.front(), 1);
+}
+
+namespace {
+// Counts copies and moves; Nothrow selects whether the move constructor is
+// noexcept, which decides if growth may move instead of copy.
+template <bool Nothrow>
+struct Relocated {
+  static inline int copies = 0;
+  static inline int moves = 0;
+  explicit Relocated(int v) : value(v) {}
+  Relocated(const Relocated &other) : value(other.value) { copies++; }
+  Relocated(Relocated &&other) noexcept(Nothrow) : value(other.value) {
+    moves++;
+  }
+  Relocated &operator=(const Relocated &other) = default;
+  int value;
+};
+}  // namespace
+
+TEST(test_vector, growth_moves_nothrow_elements) {
+  using Item = Relocated<true>;
+  Item::copies = Item::moves = 0;
+  s21::vector<Item> v;
+  for (int i = 0; i < 100; i++) v.push_back(Item(i));
+  ASSERT_EQ(Item::copies, 0);
+  ASSERT_GT(Item::moves, 100);
+  ASSERT_EQ(v[57].value, 57);
+}
+
+TEST(test_vector, growth_copies_throwing_move_elements) {
+  using Item = Relocated<false>;
+  Item::copies = Item::moves = 0;
+  s21::vector<Item> v;
+  for (int i = 0; i < 100; i++) v.push_back(Item(i));
+  ASSERT_EQ(Item::moves, 100);
+  ASSERT_GT(Item::copies, 0);
+  ASSERT_EQ(v[57].value, 57);
+}
+
+TEST(test_vector, growth_moves_nested_vectors) {
+  static_assert(std::is_nothrow_move_constructible_v<s21::vector<int>>);
+  s21::vector<s21::vector<int>> v;
+  s21::vector<const int *> buffers;
+  for (int i = 0; i < 100; i++) {
+    v.push_back(s21::vector<int>(4, i));
+    buffers.push_back(v.back().data());
+  }
+  // A copy would have given every inner vector a new buffer.
+  for (int i = 0; i < 100; i++) ASSERT_EQ(v[i].data(), buffers[i]);
+  ASSERT_EQ(v[57][3], 57);
+}
+
+namespace {
+// Copies fail once the budget runs out (a budget of -1 never does). The
+// move constructor may throw, so relocation copies these elements.
+struct Fragile {
+  static inline int budget = -1;
+  static inline int live = 0;
+  explicit Fragile(int v) : value(v) { live++; }
+  Fragile(const Fragile &other) : value(other.value) {
+    if (budget == 0) throw std::runtime_error("copy failed");
+    if (budget > 0) budget--;
+    live++;
+  }
+  Fragile(Fragile &&other) noexcept(false) : Fragile(other) {}
+  Fragile &operator=(const Fragile &other) = default;
+  ~Fragile() { live--; }
+  int value;
+};
+
+// Fragile whose moves never throw nor spend the budget.
+struct Sturdy : Fragile {
+  explicit Sturdy(int v) : Fragile(v) {}
+  Sturdy(const Sturdy &other) = default;
+  Sturdy(Sturdy &&other) noexcept : Fragile(other.value) {}
+  Sturdy &operator=(const Sturdy &other) = default;
+};
+}  // namespace
+
+TEST(test_vector, failed_growth_leaves_vector_intact) {
+  Fragile::budget = -1;
+  Fragile::live = 0;
+  {
+    s21::vector<Fragile> v;
+    for (int i = 0; i < 8; i++) v.emplace_back(i);
+    const auto capacity = v.capacity();
+    ASSERT_EQ(v.size(), capacity);
+    // Relocating the old elements fails.
+    Fragile::budget = 5;
+    ASSERT_THROW(v.emplace_back(8), std::runtime_error);
+    // Fails in the tail, after the head has been copied.
+    Fragile::budget = 5;
+    ASSERT_THROW(v.insert(v.begin() + 3, Fragile(9)), std::runtime_error);
+    // The new element itself fails.
+    Fragile::budget = 0;
+    ASSERT_THROW(v.push_back(Fragile(9)), std::runtime_error);
+    // resize fails filling the new slots, then relocating.
+    Fragile::budget = 5;
+    ASSERT_THROW(v.resize(20, Fragile(9)), std::runtime_error);
+    Fragile::budget = 15;
+    ASSERT_THROW(v.resize(20, Fragile(9)), std::runtime_error);
+    Fragile::budget = -1;
+    ASSERT_EQ(v.size(), 8);
+    ASSERT_EQ(v.capacity(), capacity);
+    for (int i = 0; i < 8; i++) ASSERT_EQ(v[i].value, i);
+    ASSERT_EQ(Fragile::live, 8);
+  }
+  ASSERT_EQ(Fragile::live, 0);
+
+  // A constructor that throws frees what it allocated.
+  const Fragile seed(1);
+  Fragile::budget = 3;
+  ASSERT_THROW(s21::vector<Fragile>(10, seed), std::runtime_error);
+  Fragile::budget = 3;
+  ASSERT_THROW(s21::vector<Fragile>({seed, seed, seed, seed, seed}),
+               std::runtime_error);
+  Fragile::budget = -1;
+  ASSERT_EQ(Fragile::live, 1);
+}
+
+TEST(test_vector, failed_insert_closes_gap) {
+  Fragile::budget = -1;
+  Fragile::live = 0;
+  {
+    const Sturdy nine(9);
+    const std::list<Sturdy> nines(3, nine);
+    s21::vector<Sturdy> v;
+    v.reserve(16);
+    for (int i = 0; i < 8; i++) v.emplace_back(i);
+    // The gap reaches past the old end: two slots are assigned, then
+    // constructing the third fails.
+    Fragile::budget = 1;
+    ASSERT_THROW(v.insert(v.begin() + 6, 3, nine), std::runtime_error);
+    Fragile::budget = 0;
+    ASSERT_THROW(v.insert(v.begin() + 6, nines.begin(), nines.end()),
+                 std::runtime_error);
+    // Growing fails while building the new elements.
+    Fragile::budget = 5;
+    ASSERT_THROW(v.insert(v.begin() + 2, 10, nine), std::runtime_error);
+    Fragile::budget = -1;
+    ASSERT_EQ(v.size(), 8);
+    ASSERT_EQ(v.capacity(), 16);
+    for (int i = 0; i < 8; i++) ASSERT_EQ(v[i].value, i);
+    ASSERT_EQ(Fragile::live, 8 + 1 + 3);
+  }
+  ASSERT_EQ(Fragile::live, 0);
+
+  {
+    const Fragile nine(9);
+    s21::vector<Fragile> v;
+    v.reserve(16);
+    for (int i = 0; i < 8; i++) v.emplace_back(i);
+    // The tail is copied out of the way and cannot be copied back.
+    Fragile::budget = 3;
+    ASSERT_THROW(v.insert(v.begin() + 6, 3, nine), std::runtime_error);
+    Fragile::budget = -1;
+    ASSERT_EQ(v.size(), 6);
+    for (int i = 0; i < 6; i++) ASSERT_EQ(v[i].value, i);
+    ASSERT_EQ(Fragile::live, 6 + 1);
+  }
+  ASSERT_EQ(Fragile::live, 0);
+}
+
+TEST(test_vector, push_back_move_only) {
+  s21::vector<std::unique_ptr<int>> v;
+  for (int i = 0; i < 20; i++) v.push_back(std::make_unique<int>(i));
+  ASSERT_EQ(v.size(), 20);
+  ASSERT_EQ(*v[13], 13);
+
+  std::string s(100, 'x');
+  s21::vector<std::string> strings;
+  strings.push_back(std::move(s));
+  ASSERT_EQ(strings[0].size(), 100);
+}
+
+TEST(test_vector, emplace_back) {
+  s21::vector<std::pair<int, std::string>> v;
+  auto &first = v.emplace_back(1, "one");
+  ASSERT_EQ(first.second, "one");
+  for (int i = 2; i < 10; i++) v.emplace_back(i, std::string(i, 'x'));
+  ASSERT_EQ(v.size(), 9);
+  ASSERT_EQ(v[8].first, 9);
+  ASSERT_EQ(v[8].second, "xxxxxxxxx");
+
+  using Item = Relocated<true>;
+  s21::vector<Item> items;
+  items.reserve(4);
+  int moves = Item::moves;
+  int copies = Item::copies;
+  items.emplace_back(1).value = 10;
+  items.emplace_back(2);
+  ASSERT_EQ(Item::moves, moves);
+  ASSERT_EQ(Item::copies, copies);
+  ASSERT_EQ(items[0].value, 10);
+}
+
+TEST(test_vector, emplace) {
+  s21::vector<std::string> v{"b", "d"};
+  auto it = v.emplace(v.cbegin(), "a");
+  ASSERT_EQ(*it, "a");
+  it = v.emplace(v.cbegin() + 2, 1, 'c');
+  ASSERT_EQ(*it, "c");
+  it = v.emplace(v.cend(), "e");
+  ASSERT_EQ(*it, "e");
+
+  s21::vector<std::string> expected{"a", "b", "c", "d", "e"};
+  ASSERT_EQ(v, expected);
+
+  v.reserve(16);
+  v.emplace(v.cbegin() + 1, v.back());
+  v.emplace(v.cbegin(), v[3]);
+  ASSERT_EQ(v[0], "c");
+  ASSERT_EQ(v[2], "e");
+  ASSERT_EQ(v.size(), 7);
+}
+
+TEST(test_vector, insert_moves_rvalue) {
+  s21::vector<std::unique_ptr<int>> v;
+  v.push_back(std::make_unique<int>(2));
+  v.insert(v.cbegin(), std::make_unique<int>(1));
+  v.insert(v.cend(), std::make_unique<int>(3));
+  for (int i = 0; i < 3; i++) ASSERT_EQ(*v[i], i + 1);
+}
+
+TEST(test_vector, insert_range_in_place) {
+  s21::vector<std::string> v{"a", "b", "f", "g", "h"};
+  v.reserve(16);
+  const std::string *data = v.data();
+  std::vector<std::string> src{"c", "d", "e"};
+
+  auto it = v.insert(v.cbegin() + 2, src.begin(), src.end());
+  ASSERT_EQ(*it, "c");
+  ASSERT_EQ(v.data(), data);
+  s21::vector<std::string> expected{"a", "b", "c", "d", "e", "f", "g", "h"};
+  ASSERT_EQ(v, expected);
+
+  // Fewer elements after pos than inserted ones.
+  std::vector<std::string> tail{"x", "y", "z"};
+  v.insert(v.cbegin() + 7, tail.begin(), tail.end());
+  ASSERT_EQ(v.size(), 11);
+  ASSERT_EQ(v[7], "x");
+  ASSERT_EQ(v[9], "z");
+  ASSERT_EQ(v.back(), "h");
+}
+
+TEST(test_vector, insert_range_reallocates) {
+  s21::vector<int> v{1, 2, 6};
+  std::vector<int> src{3, 4, 5};
+  auto it = v.insert(v.cbegin() + 2, src.begin(), src.end());
+  ASSERT_EQ(*it, 3);
+  for (int i = 0; i < 6; i++) ASSERT_EQ(v[i], i + 1);
+
+  v.insert(v.cbegin(), 3, v[5]);
+  ASSERT_EQ(v.size(), 9);
+  ASSERT_EQ(v[0], 6);
+  ASSERT_EQ(v[2], 6);
+  ASSERT_EQ(v[3], 1);
+}
+
+TEST(test_vector, insert_single_pass_range) {
+  s21::vector<int> v{1, 5};
+  std::istringstream in("2 3 4");
+  auto it = v.insert(v.cbegin() + 1, std::istream_iterator<int>(in),
+                     std::istream_iterator<int>());
+  ASSERT_EQ(*it, 2);
+  for (int i = 0; i < 5; i++) ASSERT_EQ(v[i], i + 1);
+}
+
+TEST(test_vector, append) {
+  s21::vector<int> v{1};
+  std::list<int> src{2, 3, 4};
+  v.append(src.begin(), src.end());
+  std::istringstream in("5 6");
+  v.append(std::istream_iterator<int>(in), std::istream_iterator<int>());
+  ASSERT_EQ(v.size(), 6);
+  for (int i = 0; i < 6; i++) ASSERT_EQ(v[i], i + 1);
+}
+
+TEST(test_vector, insert_keeps_elements_alive) {
+  {
+    s21::vector<Tracked> v;
+    for (int i = 0; i < 6; i++) v.push_back(Tracked(i));
+    v.reserve(32);
+    s21::vector<Tracked> src{Tracked(10), Tracked(11)};
+    v.insert(v.cbegin() + 1, src.begin(), src.end());
+    v.insert(v.cbegin() + 7, src.begin(), src.end());
+    v.insert(v.cbegin() + 3, 4, Tracked(12));
+    ASSERT_EQ(v.size(), 14);
+    ASSERT_EQ(Tracked::live, 16);
+    ASSERT_EQ(v[1].value, 10);
+    ASSERT_EQ(v[3].value, 12);
+    ASSERT_EQ(v[7].value, 1);
+    ASSERT_EQ(v[11].value, 10);
+    ASSERT_EQ(v.back().value, 5);
+  }
+  ASSERT_EQ(Tracked::live, 0);
+}
+
+TEST(test_vector, push_pop_keeps_storage) {
+  s21::vector<int> v(8);
+  v.push_back(1);
+  const int *data = v.data();
+  for (int i = 0; i < 100; i++) {
+    v.pop_back();
+    v.push_back(i);
+  }
+  ASSERT_EQ(v.data(), data);
+  ASSERT_EQ(v.capacity(), 16);
+
+  v.resize(12);
+  v.resize(3);
+  v.resize(16);
+  ASSERT_EQ(v.data(), data);
+}
+
+TEST(test_vector, shrink_to_fit_releases) {
+  s21::vector<std::string> v;
+  for (int i = 0; i < 100; i++) v.push_back(std::to_string(i));
+  v.erase(v.begin() + 10, v.end());
+  ASSERT_EQ(v.capacity(), 128);
+
+  v.shrink_to_fit();
+  ASSERT_EQ(v.capacity(), 10);
+  ASSERT_EQ(v.back(), "9");
+
+  v.clear();
+  v.shrink_to_fit();
+  ASSERT_EQ(v.capacity(), 0);
+  ASSERT_EQ(v.data(), nullptr);
+}
+
+TEST(test_vector, growth_policies) {
+  s21::vector<int, std::allocator<int>, s21::half_growth> half;
+  s21::vector<int, std::allocator<int>, s21::exact_growth> exact;
+  std::vector<std::size_t> half_caps;
+  for (int i = 0; i < 10; i++) {
+    half.push_back(i);
+    exact.push_back(i);
+    ASSERT_EQ(exact.capacity(), exact.size());
+    if (half_caps.empty() || half_caps.back() != half.capacity()) {
+      half_caps.push_back(half.capacity());
+    }
+  }
+  std::vector<std::size_t> expected{1, 2, 3, 4, 6, 9, 13};
+  ASSERT_EQ(half_caps, expected);
+
+  half.reserve(20);
+  ASSERT_EQ(half.capacity(), 20);
+  s21::vector<int, std::allocator<int>, s21::half_growth> copy(half);
+  ASSERT_EQ(copy, half);
+  ASSERT_EQ(copy.capacity(), 10);
+}
+
+namespace {
+// Stateful allocator charging the bytes it hands out to an arena counter.
+// Allocators of different arenas compare unequal and do not propagate.
+template <class T>
+struct ArenaAllocator {
+  using value_type = T;
+
+  explicit ArenaAllocator(long *arena) : bytes(arena) {}
+
+  template <class U>
+  ArenaAllocator(const ArenaAllocator<U> &other) : bytes(other.bytes) {}
+
+  T *allocate(std::size_t n) {
+    *bytes += n * sizeof(T);
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T *p, std::size_t n) {
+    *bytes -= n * sizeof(T);
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  bool operator==(const ArenaAllocator &other) const {
+    return bytes == other.bytes;
+  }
+
+  bool operator!=(const ArenaAllocator &other) const {
+    return bytes != other.bytes;
+  }
+
+  long *bytes;
+};
+
+using arena_vector = s21::vector<int, ArenaAllocator<int>>;
+}  // namespace
+
+TEST(test_vector, allocator_owns_storage) {
+  static_assert(sizeof(s21::vector<int>) == 3 * sizeof(void *));
+  long bytes = 0;
+  ArenaAllocator<int> arena(&bytes);
+  {
+    arena_vector v(arena);
+    for (int i = 0; i < 100; i++) v.push_back(i);
+    ASSERT_EQ(bytes, v.capacity() * sizeof(int));
+
+    arena_vector copy(v);
+    ASSERT_TRUE(copy.get_allocator() == arena);
+    ASSERT_EQ(bytes, (v.capacity() + copy.capacity()) * sizeof(int));
+
+    v.shrink_to_fit();
+    ASSERT_EQ(bytes, (v.capacity() + copy.capacity()) * sizeof(int));
+  }
+  ASSERT_EQ(bytes, 0);
+}
+
+TEST(test_vector, allocator_move_between_arenas) {
+  long bytes1 = 0;
+  long bytes2 = 0;
+  ArenaAllocator<int> arena1(&bytes1);
+  ArenaAllocator<int> arena2(&bytes2);
+  {
+    arena_vector v({1, 2, 3}, arena1);
+    arena_vector w(arena2);
+    w = std::move(v);
+    ASSERT_EQ(w, arena_vector({1, 2, 3}, arena1));
+    ASSERT_TRUE(w.get_allocator() == arena2);
+    ASSERT_EQ(bytes2, w.capacity() * sizeof(int));
+    ASSERT_TRUE(v.empty());
+
+    arena_vector stolen(std::move(w));
+    ASSERT_EQ(stolen.size(), 3);
+    ASSERT_TRUE(stolen.get_allocator() == arena2);
+  }
+  ASSERT_EQ(bytes1, 0);
+  ASSERT_EQ(bytes2, 0);
+}
+
 TEST(test_vector, swap) {
   s21::vector<int> a{1, 2, 3, 4, 5};
   s21::vector<int> a_copy = a;
@@ -691,3 +1210,30 @@ TEST(test_vector, insert_many_back) {
   it++;
   ASSERT_EQ(*it, 3);
 }
+
+TEST(test_vector, find_and_count) {
+  s21::vector<int> v(100, 1);
+  v[70] = 2;
+  v[90] = 2;
+  ASSERT_EQ(s21::find(v, 2) - v.begin(), 70);
+  ASSERT_EQ(s21::find(v, 3), v.end());
+  ASSERT_EQ(s21::count(v, 2), 2);
+
+  const s21::vector<std::string> words{"a", "b", "a"};
+  ASSERT_EQ(s21::find(words, std::string("b")) - words.begin(), 1);
+  ASSERT_EQ(s21::count(words, std::string("a")), 2);
+}
+
+TEST(test_vector, compare_long) {
+  s21::vector<double> a(100, 1.5);
+  s21::vector<double> b(a);
+  ASSERT_EQ(a, b);
+  b[77] = 2.5;
+  ASSERT_NE(a, b);
+  ASSERT_LT(a, b);
+  ASSERT_LE(a, b);
+  ASSERT_GT(b, a);
+  ASSERT_GE(b, a);
+  a.push_back(0.0);
+  ASSERT_LT(a, b);
+}
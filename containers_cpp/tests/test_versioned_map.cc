@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <thread>
+
+#include "../src/s21_versioned_map.h"
+
+TEST(test_versioned_map, create_default) {
+  s21::versioned_map<int, int> m;
+  ASSERT_TRUE(m.empty());
+  ASSERT_EQ(m.version(), 0);
+  auto snap = m.get_snapshot();
+  ASSERT_TRUE(snap.begin() == snap.end());
+}
+
+TEST(test_versioned_map, create_from_ilist) {
+  s21::versioned_map<int, int> m(
+      {std::make_pair(2, 20), std::make_pair(1, 10), std::make_pair(3, 30)});
+  ASSERT_EQ(m.size(), 3);
+  ASSERT_EQ(m.version(), 3);
+  ASSERT_EQ(m.get_snapshot().at(2), 20);
+}
+
+TEST(test_versioned_map, writes_commit_versions) {
+  s21::versioned_map<int, int> m;
+  ASSERT_TRUE(m.insert(1, 10));
+  ASSERT_FALSE(m.insert(1, 11));
+  ASSERT_EQ(m.version(), 1);
+  ASSERT_FALSE(m.insert_or_assign(1, 12));
+  ASSERT_EQ(m.version(), 2);
+  ASSERT_EQ(m.get_snapshot().at(1), 12);
+  ASSERT_FALSE(m.erase(5));
+  ASSERT_TRUE(m.erase(1));
+  ASSERT_EQ(m.version(), 3);
+  ASSERT_TRUE(m.empty());
+  ASSERT_THROW(m.get_snapshot().at(1), std::out_of_range);
+}
+
+TEST(test_versioned_map, snapshot_is_isolated) {
+  s21::versioned_map<int, int> m;
+  for (int i = 0; i < 10; i++) m.insert(i, i);
+  auto snap = m.get_snapshot();
+  m.erase(3);
+  m.insert_or_assign(4, 40);
+  m.insert(20, 20);
+  ASSERT_EQ(snap.size(), 10);
+  ASSERT_TRUE(snap.contains(3));
+  ASSERT_EQ(snap.at(4), 4);
+  ASSERT_FALSE(snap.contains(20));
+  int expected = 0;
+  for (auto it = snap.begin(); it != snap.end(); ++it) {
+    ASSERT_EQ(it.get_key(), expected);
+    ASSERT_EQ(*it, expected);
+    expected++;
+  }
+  ASSERT_EQ(expected, 10);
+  ASSERT_FALSE(m.contains(3));
+  ASSERT_EQ(m.get_snapshot().at(4), 40);
+}
+
+TEST(test_versioned_map, old_versions_are_collected) {
+  s21::versioned_map<int, int> m;
+  m.insert(1, 1);
+  auto snap = m.get_snapshot();
+  m.insert(2, 2);
+  m.insert(3, 3);
+  ASSERT_EQ(m.live_versions(), 2);
+  ASSERT_EQ(m.get_snapshot(1).size(), 1);
+  ASSERT_THROW(m.get_snapshot(2), std::out_of_range);
+  snap = m.get_snapshot();
+  m.insert(4, 4);
+  ASSERT_EQ(m.live_versions(), 2);
+  ASSERT_THROW(m.get_snapshot(1), std::out_of_range);
+  snap = decltype(snap)();
+  ASSERT_EQ(m.live_versions(), 1);
+}
+
+TEST(test_versioned_map, for_each_early_exit) {
+  s21::versioned_map<int, int> m;
+  for (int i = 0; i < 10; i++) m.insert(i, i * i);
+  int sum = 0;
+  m.get_snapshot().for_each([&sum](const int &key, const int &value) {
+    sum += value;
+    return key < 3;
+  });
+  ASSERT_EQ(sum, 0 + 1 + 4 + 9);
+}
+
+TEST(test_versioned_map, random_operations) {
+  s21::versioned_map<int, int> m;
+  std::map<int, int> expected;
+  std::mt19937 gen(1);
+  for (int i = 0; i < 3000; i++) {
+    int key = static_cast<int>(gen() % 300);
+    if (gen() % 3) {
+      m.insert_or_assign(key, i);
+      expected[key] = i;
+    } else {
+      ASSERT_EQ(m.erase(key), expected.erase(key) == 1);
+    }
+  }
+  auto snap = m.get_snapshot();
+  ASSERT_EQ(snap.size(), expected.size());
+  auto it = snap.begin();
+  for (auto &entry : expected) {
+    ASSERT_EQ(it.get_key(), entry.first);
+    ASSERT_EQ(*it, entry.second);
+    ++it;
+  }
+  ASSERT_TRUE(it == snap.end());
+}
+
+TEST(test_versioned_map, readers_see_consistent_snapshots) {
+  s21::versioned_map<int, int> m;
+  std::atomic<bool> done(false);
+  std::thread writer([&] {
+    for (int i = 0; i < 2000; i++) {
+      m.insert(i, i);
+      if (i % 3 == 0) m.erase(i / 2);
+    }
+    done = true;
+  });
+  bool consistent = true;
+  while (!done) {
+    auto snap = m.get_snapshot();
+    std::size_t n = 0;
+    int prev = -1;
+    for (auto it = snap.begin(); it != snap.end(); ++it, n++) {
+      if (it.get_key() <= prev || *it != it.get_key()) consistent = false;
+      prev = it.get_key();
+    }
+    if (n != snap.size()) consistent = false;
+  }
+  writer.join();
+  ASSERT_TRUE(consistent);
+}